@@ -237,6 +237,18 @@ class V8_EXPORT Isolate {
      */
     const StartupData* snapshot_blob = nullptr;
 
+    /**
+     * Whether to cache the decompressed data of a context snapshot once the
+     * first context has been created from it, instead of decompressing it
+     * again for every new context. This saves the decompression time when
+     * creating many short-lived contexts, at the cost of memory for the
+     * lifetime of the isolate. Contexts are still deserialized as before.
+     * This has no effect unless V8 is built with snapshot compression
+     * (v8_enable_snapshot_compression, the default on Android, ChromeOS and
+     * Fuchsia).
+     */
+    bool cache_decompressed_context_snapshots = false;
+
     /**
      * Enables the host application to provide a mechanism for recording
      * statistics counters.
@@ -724,6 +736,17 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Optional estimate of how expensive it is for this isolate to recompile a
+   * function after its bytecode or baseline code has been flushed, relative
+   * to the default of 1.0. Values above 1.0 make V8 keep the code of unused
+   * functions for longer, values below 1.0 make it flush earlier. Only has an
+   * effect with --flush-code-adaptively, which also flushes more aggressively
+   * after MemoryPressureNotification(). The V8.FlushedBytecode and
+   * V8.RecompiledAfterFlush counters can be used to tune the estimate.
+   */
+  void SetCodeFlushingRecompileCost(double cost);
+
   /**
    * Optional request from the embedder to tune v8 towards energy efficiency
    * rather than speed if `battery_saver_mode_enabled` is true, because the
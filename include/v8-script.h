@@ -30,6 +30,7 @@ class Script;
 
 namespace internal {
 class BackgroundDeserializeTask;
+class CodeCacheBundle;
 struct ScriptStreamingData;
 }  // namespace internal
 
@@ -459,6 +460,89 @@ class V8_EXPORT ScriptCompiler {
     CachedData& operator=(const CachedData&) = delete;
   };
 
+  /**
+   * A set of compile hints, i.e. positions of functions which should be
+   * compiled eagerly. The hints are typically collected during a warm-up run
+   * with a CompileHintsCollector, serialized with Serialize() and stored next
+   * to the code cache of the script.
+   *
+   * On the next run, pass CompileHintsData::Callback together with the
+   * deserialized object as compile hint callback and data to Source or
+   * StartStreaming, and compile with kConsumeCompileHints. The hinted
+   * functions are then compiled together with the top-level code, on the
+   * background thread if the script is compiled off-thread. The object must
+   * stay alive until compilation has finished.
+   */
+  class V8_EXPORT CompileHintsData final {
+   public:
+    explicit CompileHintsData(const std::vector<int>& positions);
+
+    /**
+     * Returns the hints collected by {collector} so far.
+     */
+    static std::unique_ptr<CompileHintsData> FromCollector(
+        Isolate* isolate, Local<CompileHintsCollector> collector);
+
+    /**
+     * Returns a compact serialization of the hints for the given source.
+     */
+    std::unique_ptr<CachedData> Serialize(Local<String> source) const;
+
+    /**
+     * Returns nullptr if {data} is malformed or was serialized for a
+     * different source, as detected by the length and a hash of the source.
+     */
+    static std::unique_ptr<CompileHintsData> Deserialize(const uint8_t* data,
+                                                         size_t length,
+                                                         Local<String> source);
+
+    /**
+     * A CompileHintCallback which expects a CompileHintsData as data. It may
+     * be called concurrently from several threads.
+     */
+    static bool Callback(int position, void* data);
+
+    const std::vector<int>& positions() const { return positions_; }
+
+   private:
+    // Sorted and without duplicates.
+    std::vector<int> positions_;
+  };
+
+  /**
+   * Provides the code caches of the scripts in a bundle created with
+   * CreateCodeCacheBundle. The strings shared by the scripts are deserialized
+   * when the bundle is opened, while each script is only deserialized once it
+   * is compiled with the cached data returned by GetCachedData and
+   * kConsumeCodeCache, possibly with a ConsumeCodeCacheTask. The bundle data
+   * must outlive the CodeCacheBundle, which in turn must outlive the
+   * compilations consuming its cached data, and must be destroyed before the
+   * isolate.
+   */
+  class V8_EXPORT CodeCacheBundle final {
+   public:
+    CodeCacheBundle(Isolate* isolate, const CachedData* bundle);
+    ~CodeCacheBundle();
+    CodeCacheBundle(const CodeCacheBundle&) = delete;
+    CodeCacheBundle& operator=(const CodeCacheBundle&) = delete;
+
+    /**
+     * Returns the number of scripts in the bundle, which is 0 if the bundle
+     * was rejected.
+     */
+    int GetScriptCount() const;
+
+    /**
+     * Returns the cached data of the script at {index}, in the order the
+     * scripts were passed to CreateCodeCacheBundle. The CachedData does not
+     * own its buffer and should be owned by the caller.
+     */
+    CachedData* GetCachedData(int index) const;
+
+   private:
+    std::unique_ptr<internal::CodeCacheBundle> impl_;
+  };
+
   enum class InMemoryCacheResult {
     // V8 did not attempt to find this script in its in-memory cache.
     kNotAttempted,
@@ -856,6 +940,28 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script);
 
+  /**
+   * Creates and returns a code cache delta for the functions of the specified
+   * unbound_script which were compiled, but are not contained in code_cache
+   * yet. Appending the delta to code_cache yields a code cache which contains
+   * these functions as well, while the functions already in code_cache are
+   * not serialized again. This will return nullptr if there is nothing to
+   * add, or if code_cache was not created for unbound_script. The CachedData
+   * returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateCodeCacheDelta(Local<UnboundScript> unbound_script,
+                                          const CachedData* code_cache);
+
+  /**
+   * Creates and returns a code cache bundle for the specified unbound
+   * scripts, which are consumed individually with CodeCacheBundle. Strings
+   * used by more than one of the scripts are serialized only once. This will
+   * return nullptr if any of the scripts cannot be serialized. The CachedData
+   * returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateCodeCacheBundle(
+      MemorySpan<const Local<UnboundScript>> unbound_scripts);
+
   /**
    * Creates and returns code cache for the specified unbound_module_script.
    * This will return nullptr if the script cannot be serialized. The
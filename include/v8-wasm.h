@@ -199,6 +199,25 @@ class V8_EXPORT WasmStreaming final {
   std::unique_ptr<WasmStreamingImpl> impl_;
 };
 
+/**
+ * A cache of compiled WebAssembly modules on disk, for embedders that do not
+ * implement code caching themselves (e.g. via
+ * {WasmStreaming::SetMoreFunctionsCanBeSerializedCallback}). Asynchronous and
+ * streaming compilations look up their module in the cache and store it once
+ * it tiered up. Entries are rejected if they were written by a different V8
+ * version or are corrupted.
+ */
+class V8_EXPORT WasmModuleCache final {
+ public:
+  /**
+   * Enables the cache in the existing directory {directory}, whose total
+   * size is bounded to about {max_size} bytes by evicting the oldest entries.
+   * Passing nullptr disables the cache again. The directory can be shared by
+   * several processes. Must be called after V8 has been initialized.
+   */
+  static void SetDirectory(const char* directory, size_t max_size);
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_WASM_H_
@@ -41,6 +41,7 @@
 #include "src/base/safe_conversions.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/base/vector.h"
+#include "src/base/vlq.h"
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins-utils.h"
 #include "src/codegen/compilation-cache.h"
@@ -2231,6 +2232,177 @@ std::vector<int> CompileHintsCollector::GetCompileHints(
   return result;
 }
 
+namespace {
+
+// Serialized compile hints consist of a header with the magic number, the
+// source length and the source hash, followed by the VLQ-encoded number of
+// hints and the VLQ-encoded deltas between the sorted positions.
+constexpr uint32_t kCompileHintsMagicNumber = 0xC0DE4802;
+constexpr size_t kCompileHintsHeaderSize = 3 * sizeof(uint32_t);
+
+void WriteCompileHintsHeaderField(std::vector<uint8_t>* data, uint32_t value) {
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    data->push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+uint32_t ReadCompileHintsHeaderField(const uint8_t* data) {
+  uint32_t value = 0;
+  for (size_t i = 0; i < sizeof(value); ++i) {
+    value |= static_cast<uint32_t>(data[i]) << (8 * i);
+  }
+  return value;
+}
+
+// Hashes the characters of a source (FNV-1a), independently of whether it is
+// stored as a one-byte or two-byte string. The string hash of the source
+// can't be used, since it is seeded per isolate and only covers the length
+// of long strings. The visitor hashes the flat parts of the source one after
+// the other, so that the source doesn't have to be flattened.
+class CompileHintsSourceHasher {
+ public:
+  void VisitOneByteString(const uint8_t* chars, int length) {
+    AddCharacters(chars, length);
+  }
+  void VisitTwoByteString(const uint16_t* chars, int length) {
+    AddCharacters(chars, length);
+  }
+
+  uint32_t hash() const { return hash_; }
+
+ private:
+  template <typename Char>
+  void AddCharacters(const Char* chars, int length) {
+    for (int i = 0; i < length; ++i) {
+      hash_ = (hash_ ^ static_cast<uint16_t>(chars[i])) * 16777619u;
+    }
+  }
+
+  uint32_t hash_ = 2166136261u;
+};
+
+uint32_t HashCompileHintsSource(Local<String> source) {
+  i::DisallowGarbageCollection no_gc;
+  CompileHintsSourceHasher hasher;
+  i::Tagged<i::ConsString> cons_string =
+      i::String::VisitFlat(&hasher, *Utils::OpenDirectHandle(*source));
+  if (!cons_string.is_null()) {
+    i::ConsStringIterator iter(cons_string);
+    int offset;
+    for (i::Tagged<i::String> segment = iter.Next(&offset); !segment.is_null();
+         segment = iter.Next(&offset)) {
+      i::String::VisitFlat(&hasher, segment, offset);
+    }
+  }
+  return hasher.hash();
+}
+
+}  // namespace
+
+ScriptCompiler::CompileHintsData::CompileHintsData(
+    const std::vector<int>& positions)
+    : positions_(positions) {
+  std::sort(positions_.begin(), positions_.end());
+  positions_.erase(std::unique(positions_.begin(), positions_.end()),
+                   positions_.end());
+}
+
+// static
+std::unique_ptr<ScriptCompiler::CompileHintsData>
+ScriptCompiler::CompileHintsData::FromCollector(
+    Isolate* isolate, Local<CompileHintsCollector> collector) {
+  return std::make_unique<CompileHintsData>(
+      collector->GetCompileHints(isolate));
+}
+
+std::unique_ptr<ScriptCompiler::CachedData>
+ScriptCompiler::CompileHintsData::Serialize(Local<String> source) const {
+  std::vector<uint8_t> data;
+  data.reserve(kCompileHintsHeaderSize + 2 * positions_.size());
+  WriteCompileHintsHeaderField(&data, kCompileHintsMagicNumber);
+  WriteCompileHintsHeaderField(&data, static_cast<uint32_t>(source->Length()));
+  WriteCompileHintsHeaderField(&data, HashCompileHintsSource(source));
+  i::base::VLQEncodeUnsigned(&data, static_cast<uint32_t>(positions_.size()));
+  int previous = 0;
+  for (int position : positions_) {
+    DCHECK_LE(previous, position);
+    i::base::VLQEncodeUnsigned(&data,
+                               static_cast<uint32_t>(position - previous));
+    previous = position;
+  }
+  uint8_t* buffer = new uint8_t[data.size()];
+  std::copy(data.begin(), data.end(), buffer);
+  return std::make_unique<CachedData>(buffer, static_cast<int>(data.size()),
+                                      CachedData::BufferOwned);
+}
+
+// static
+std::unique_ptr<ScriptCompiler::CompileHintsData>
+ScriptCompiler::CompileHintsData::Deserialize(const uint8_t* data,
+                                              size_t length,
+                                              Local<String> source) {
+  uint32_t source_length = static_cast<uint32_t>(source->Length());
+  if (length < kCompileHintsHeaderSize ||
+      ReadCompileHintsHeaderField(data) != kCompileHintsMagicNumber ||
+      ReadCompileHintsHeaderField(data + sizeof(uint32_t)) != source_length ||
+      ReadCompileHintsHeaderField(data + 2 * sizeof(uint32_t)) !=
+          HashCompileHintsSource(source)) {
+    return nullptr;
+  }
+  size_t index = kCompileHintsHeaderSize;
+  bool truncated = false;
+  auto get_next = [&]() -> uint8_t {
+    if (index < length) return data[index++];
+    truncated = true;
+    return 0;
+  };
+  uint32_t count = i::base::VLQDecodeUnsigned(get_next);
+  // Every hint takes at least one byte.
+  if (truncated || count > length - index) return nullptr;
+  std::vector<int> positions;
+  positions.reserve(count);
+  uint32_t position = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    uint32_t delta = i::base::VLQDecodeUnsigned(get_next);
+    if (truncated || delta > source_length - position) return nullptr;
+    position += delta;
+    positions.push_back(static_cast<int>(position));
+  }
+  if (index != length) return nullptr;
+  return std::make_unique<CompileHintsData>(positions);
+}
+
+// static
+bool ScriptCompiler::CompileHintsData::Callback(int position, void* data) {
+  const std::vector<int>& positions =
+      static_cast<const CompileHintsData*>(data)->positions_;
+  return std::binary_search(positions.begin(), positions.end(), position);
+}
+
+ScriptCompiler::CodeCacheBundle::CodeCacheBundle(Isolate* isolate,
+                                                 const CachedData* bundle) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  impl_ = std::make_unique<i::CodeCacheBundle>(i_isolate, bundle->data,
+                                               bundle->length);
+}
+
+ScriptCompiler::CodeCacheBundle::~CodeCacheBundle() = default;
+
+int ScriptCompiler::CodeCacheBundle::GetScriptCount() const {
+  return impl_->script_count();
+}
+
+ScriptCompiler::CachedData* ScriptCompiler::CodeCacheBundle::GetCachedData(
+    int index) const {
+  Utils::ApiCheck(index >= 0 && index < impl_->script_count(),
+                  "ScriptCompiler::CodeCacheBundle::GetCachedData",
+                  "Index out of range");
+  base::Vector<const uint8_t> segment = impl_->ScriptSegment(index);
+  return new CachedData(segment.begin(), segment.length(),
+                        CachedData::BufferNotOwned);
+}
+
 // static
 Local<PrimitiveArray> PrimitiveArray::New(Isolate* v8_isolate, int length) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -2884,6 +3056,43 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheDelta(
+    Local<UnboundScript> unbound_script, const CachedData* code_cache) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  DCHECK(!i::HeapLayout::InReadOnlySpace(*shared));
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared);
+  Utils::ApiCheck(!i_isolate->serializer_enabled(),
+                  "ScriptCompiler::CreateCodeCacheDelta",
+                  "Cannot create code cache while creating a snapshot");
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  DCHECK(shared->is_toplevel());
+  i::AlignedCachedData aligned_code_cache(code_cache->data, code_cache->length);
+  return i::CodeSerializer::SerializeDelta(i_isolate, shared,
+                                           &aligned_code_cache);
+}
+
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheBundle(
+    MemorySpan<const Local<UnboundScript>> unbound_scripts) {
+  Utils::ApiCheck(!unbound_scripts.empty(),
+                  "ScriptCompiler::CreateCodeCacheBundle",
+                  "Expected at least one script");
+  std::vector<i::Handle<i::SharedFunctionInfo>> shared_infos;
+  for (Local<UnboundScript> unbound_script : unbound_scripts) {
+    auto shared = Utils::OpenHandle(*unbound_script);
+    DCHECK(!i::HeapLayout::InReadOnlySpace(*shared));
+    DCHECK(shared->is_toplevel());
+    shared_infos.push_back(shared);
+  }
+  i::Isolate* i_isolate = i::GetIsolateFromWritableObject(*shared_infos[0]);
+  Utils::ApiCheck(!i_isolate->serializer_enabled(),
+                  "ScriptCompiler::CreateCodeCacheBundle",
+                  "Cannot create code cache while creating a snapshot");
+  DCHECK_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  return i::CodeSerializer::SerializeBundle(i_isolate, shared_infos);
+}
+
 // static
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
     Local<UnboundModuleScript> unbound_module_script) {
@@ -8974,6 +9183,17 @@ MaybeLocal<WasmModuleObject> WasmModuleObject::Compile(
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+// static
+void WasmModuleCache::SetDirectory(const char* directory, size_t max_size) {
+#if V8_ENABLE_WEBASSEMBLY
+  i::wasm::GetWasmEngine()->SetDiskCache(directory, max_size);
+#else
+  Utils::ApiCheck(false, "WasmModuleCache::SetDirectory",
+                  "WebAssembly support is not enabled");
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
                                              size_t new_length) {
   if (old_length == new_length) return data;
@@ -9881,6 +10101,10 @@ void Isolate::Initialize(Isolate* v8_isolate,
   } else {
     i_isolate->set_snapshot_blob(i::Snapshot::DefaultSnapshotBlob());
   }
+#ifdef V8_SNAPSHOT_COMPRESSION
+  i_isolate->set_cache_decompressed_context_snapshots(
+      params.cache_decompressed_context_snapshots);
+#endif  // V8_SNAPSHOT_COMPRESSION
 
   if (params.fatal_error_callback) {
     v8_isolate->SetFatalErrorHandler(params.fatal_error_callback);
@@ -10551,6 +10775,13 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   i_isolate->heap()->MemoryPressureNotification(level, on_isolate_thread);
 }
 
+void Isolate::SetCodeFlushingRecompileCost(double cost) {
+  Utils::ApiCheck(cost > 0, "v8::Isolate::SetCodeFlushingRecompileCost",
+                  "Recompile cost must be positive");
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->SetCodeFlushingRecompileCost(cost);
+}
+
 void Isolate::SetBatterySaverMode(bool battery_saver_mode_enabled) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->set_battery_saver_mode_enabled(battery_saver_mode_enabled);
@@ -1716,11 +1716,30 @@ void Scope::SavePreparseData(Parser* parser) {
   });
 }
 
+void Scope::SavePreparseData(std::vector<uint8_t>* preparse_data_buffer,
+                             Zone* zone) {
+  this->ForEach([preparse_data_buffer, zone](Scope* scope) {
+    if (scope->IsSkippableFunctionScope() &&
+        !scope->AsDeclarationScope()->was_lazily_parsed()) {
+      scope->AsDeclarationScope()->SavePreparseDataForDeclarationScope(
+          preparse_data_buffer, zone);
+    }
+    return Iteration::kDescend;
+  });
+}
+
 void DeclarationScope::SavePreparseDataForDeclarationScope(Parser* parser) {
   if (preparse_data_builder_ == nullptr) return;
   preparse_data_builder_->SaveScopeAllocationData(this, parser);
 }
 
+void DeclarationScope::SavePreparseDataForDeclarationScope(
+    std::vector<uint8_t>* preparse_data_buffer, Zone* zone) {
+  if (preparse_data_builder_ == nullptr) return;
+  preparse_data_builder_->SaveScopeAllocationData(this, preparse_data_buffer,
+                                                  zone);
+}
+
 void DeclarationScope::AnalyzePartially(Parser* parser,
                                         AstNodeFactory* ast_node_factory,
                                         bool maybe_in_arrowhead) {
@@ -1774,6 +1793,23 @@ void DeclarationScope::AnalyzePartially(Parser* parser,
   unresolved_list_ = std::move(new_unresolved_list);
 }
 
+void DeclarationScope::AnalyzeTopLevelFunctionOffThread(
+    AstNodeFactory* ast_node_factory,
+    std::vector<uint8_t>* preparse_data_buffer, Zone* zone) {
+  DCHECK(outer_scope_->is_script_scope());
+  DCHECK(!force_eager_compilation_);
+  // Like in AnalyzePartially, only functions with inner functions have data
+  // worth saving.
+  if (preparse_data_builder_ == nullptr ||
+      !preparse_data_builder_->HasInnerFunctions()) {
+    return;
+  }
+  UnresolvedList new_unresolved_list;
+  Scope::AnalyzePartially(this, ast_node_factory, &new_unresolved_list, false);
+  DCHECK(new_unresolved_list.is_empty());
+  SavePreparseData(preparse_data_buffer, zone);
+}
+
 void DeclarationScope::RewriteReplGlobalVariables() {
   DCHECK(is_script_scope());
   if (!is_repl_mode_scope()) return;
@@ -6,6 +6,7 @@
 #define V8_AST_SCOPES_H_
 
 #include <numeric>
+#include <vector>
 
 #include "src/ast/ast.h"
 #include "src/base/compiler-specific.h"
@@ -688,6 +689,8 @@ class V8_EXPORT_PRIVATE Scope : public NON_EXPORTED_BASE(ZoneObject) {
   // Walk the scope chain to find DeclarationScopes; call
   // SavePreparseDataForDeclarationScope for each.
   void SavePreparseData(Parser* parser);
+  void SavePreparseData(std::vector<uint8_t>* preparse_data_buffer,
+                        Zone* zone);
 
   // Create a non-local variable with a given name.
   // These variables are looked up dynamically at runtime.
@@ -1175,6 +1178,14 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   void AnalyzePartially(Parser* parser, AstNodeFactory* ast_node_factory,
                         bool maybe_in_arrowhead);
 
+  // The equivalent of AnalyzePartially for a top-level function that is
+  // preparsed on a worker thread (see ParallelPreparser). Top-level functions
+  // have no free variables to migrate, so this only saves the preparse data
+  // of the function, using the given scratch buffer and zone.
+  void AnalyzeTopLevelFunctionOffThread(
+      AstNodeFactory* ast_node_factory,
+      std::vector<uint8_t>* preparse_data_buffer, Zone* zone);
+
   // Allocate ScopeInfos for top scope and any inner scopes that need them.
   // Does nothing if ScopeInfo is already allocated.
   template <typename IsolateT>
@@ -1223,6 +1234,8 @@ class V8_EXPORT_PRIVATE DeclarationScope : public Scope {
   // and its subscopes (except scopes at the laziness boundary). The data is
   // saved in produced_preparse_data_.
   void SavePreparseDataForDeclarationScope(Parser* parser);
+  void SavePreparseDataForDeclarationScope(
+      std::vector<uint8_t>* preparse_data_buffer, Zone* zone);
 
   void set_preparse_data_builder(PreparseDataBuilder* preparse_data_builder) {
     preparse_data_builder_ = preparse_data_builder;
@@ -5,7 +5,9 @@
 #include "src/baseline/baseline-batch-compiler.h"
 
 #include <algorithm>
+#include <optional>
 
+#include "src/baseline/baseline-code-cache.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/execution/isolate.h"
@@ -14,6 +16,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/init/isolate-group.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/utils/locked-queue-inl.h"
@@ -35,6 +38,9 @@ class BaselineCompilerTask {
         bytecode_(handles->NewHandle(sfi->GetBytecodeArray(isolate))) {
     DCHECK(sfi->is_compiled());
     shared_function_info_->set_is_sparkplug_compiling(true);
+    if (v8_flags.sparkplug_share_code) {
+      code_cache_key_ = BaselineCodeCache::ComputeKey(isolate, sfi, *bytecode_);
+    }
   }
 
   BaselineCompilerTask(const BaselineCompilerTask&) V8_NOEXCEPT = delete;
@@ -45,10 +51,24 @@ class BaselineCompilerTask {
     RCS_SCOPE(local_isolate, RuntimeCallCounterId::kCompileBackgroundBaseline);
     base::ScopedTimer timer(v8_flags.log_function_events ? &time_taken_
                                                          : nullptr);
-    BaselineCompiler compiler(local_isolate, shared_function_info_, bytecode_);
-    compiler.GenerateCode();
-    maybe_code_ =
-        local_isolate->heap()->NewPersistentMaybeHandle(compiler.Build());
+    MaybeHandle<Code> code;
+    if (code_cache_key_.has_value()) {
+      code = local_isolate->GetMainThreadIsolateUnsafe()
+                 ->isolate_group()
+                 ->baseline_code_cache()
+                 ->TryBuild(local_isolate, *code_cache_key_,
+                            shared_function_info_, bytecode_);
+    }
+    if (code.is_null()) {
+      BaselineCompiler compiler(local_isolate, shared_function_info_,
+                                bytecode_);
+      if (code_cache_key_.has_value()) {
+        compiler.set_code_cache_key(*code_cache_key_);
+      }
+      compiler.GenerateCode();
+      code = compiler.Build();
+    }
+    maybe_code_ = local_isolate->heap()->NewPersistentMaybeHandle(code);
   }
 
   // Executed in the main thread.
@@ -89,6 +109,7 @@ class BaselineCompilerTask {
  private:
   Handle<SharedFunctionInfo> shared_function_info_;
   Handle<BytecodeArray> bytecode_;
+  std::optional<BaselineCodeCache::Key> code_cache_key_;
   MaybeHandle<Code> maybe_code_;
   base::TimeDelta time_taken_;
 };
@@ -0,0 +1,285 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-code-cache.h"
+
+#include <vector>
+
+#include "src/base/functional.h"
+#include "src/codegen/code-desc.h"
+#include "src/codegen/code-reference.h"
+#include "src/codegen/reloc-info-inl.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate-inl.h"
+#include "src/flags/flags.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap-layout-inl.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/heap/read-only-heap.h"
+#include "src/objects/bytecode-array-inl.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/strings/string-hasher-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace baseline {
+
+struct BaselineCodeCacheEntry {
+  enum class TargetKind : uint8_t {
+    kBytecodeArray,
+    kConstantPoolEntry,
+    kReadOnlyObject,
+  };
+
+  // An object embedded into the code, in relocation order.
+  struct Target {
+    TargetKind kind;
+    // Index into the constant pool, or the address of a read-only object.
+    Address value;
+  };
+
+  bool Matches(Tagged<BytecodeArray> bytecode,
+               bool short_builtin_calls) const {
+    if (this->short_builtin_calls != short_builtin_calls) return false;
+    if (bytecode->length() != static_cast<int>(bytecodes.size())) return false;
+    if (bytecode->frame_size() != frame_size ||
+        bytecode->parameter_count() != parameter_count) {
+      return false;
+    }
+    if (memcmp(reinterpret_cast<const void*>(
+                   bytecode->GetFirstBytecodeAddress()),
+               bytecodes.data(), bytecodes.size()) != 0) {
+      return false;
+    }
+    Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+    if (constant_pool->length() != constant_pool_length) return false;
+    // Smi constants (e.g. jump table offsets) may have been baked into the
+    // code as immediates.
+    for (const auto& [index, value] : smi_constants) {
+      Tagged<Object> constant = constant_pool->get(index);
+      if (!IsSmi(constant) || Smi::ToInt(constant) != value) return false;
+    }
+    return true;
+  }
+
+  size_t size_in_bytes() const {
+    return sizeof(*this) + desc.buffer_size + bytecodes.size() +
+           bytecode_offset_table.size() + targets.size() * sizeof(Target) +
+           smi_constants.size() * sizeof(smi_constants[0]);
+  }
+
+  // The bytecode that this code was generated for.
+  std::vector<uint8_t> bytecodes;
+  int frame_size;
+  uint16_t parameter_count;
+  int constant_pool_length;
+  std::vector<std::pair<int, int>> smi_constants;
+  bool short_builtin_calls;
+
+  // The assembler output. {desc.buffer} points into {buffer}.
+  std::unique_ptr<uint8_t[]> buffer;
+  CodeDesc desc;
+  std::vector<uint8_t> bytecode_offset_table;
+  std::vector<Target> targets;
+};
+
+size_t BaselineCodeCacheKey::Hash() const {
+  return base::hash_combine(source_hash, bytecode_hash);
+}
+
+BaselineCodeCache::BaselineCodeCache() = default;
+BaselineCodeCache::~BaselineCodeCache() = default;
+
+// static
+std::optional<BaselineCodeCache::Key> BaselineCodeCache::ComputeKey(
+    Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+    Tagged<BytecodeArray> bytecode) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> script = shared->script();
+  if (!IsScript(script)) return {};
+  Tagged<Object> source = Cast<Script>(script)->source();
+  if (!IsString(source)) return {};
+  Tagged<String> source_string = Cast<String>(source);
+  int start = shared->StartPosition();
+  int end = shared->EndPosition();
+  if (start < 0 || end <= start ||
+      end > static_cast<int>(source_string->length())) {
+    return {};
+  }
+  String::FlatContent content = source_string->GetFlatContent(no_gc);
+  if (!content.IsFlat()) return {};
+
+  // Hash with a fixed seed, since the hash seed of the isolate is not
+  // necessarily shared with the other isolates in the group.
+  uint32_t source_hash =
+      content.IsOneByte()
+          ? StringHasher::HashSequentialString(
+                content.ToOneByteVector().begin() + start, end - start,
+                kZeroHashSeed)
+          : StringHasher::HashSequentialString(
+                content.ToUC16Vector().begin() + start, end - start,
+                kZeroHashSeed);
+  const uint8_t* bytecodes =
+      reinterpret_cast<const uint8_t*>(bytecode->GetFirstBytecodeAddress());
+  uint32_t bytecode_hash = static_cast<uint32_t>(
+      base::hash_range(bytecodes, bytecodes + bytecode->length()));
+  return Key{source_hash, bytecode_hash};
+}
+
+MaybeHandle<Code> BaselineCodeCache::TryBuild(
+    LocalIsolate* local_isolate, const Key& key,
+    Handle<SharedFunctionInfo> shared, Handle<BytecodeArray> bytecode) {
+  std::shared_ptr<const Entry> entry = Find(key);
+  bool short_builtin_calls =
+      local_isolate->GetMainThreadIsolateUnsafe()
+          ->is_short_builtin_calls_enabled();
+  if (!entry || !entry->Matches(*bytecode, short_builtin_calls)) {
+    RecordMiss();
+    return {};
+  }
+
+  std::vector<IndirectHandle<HeapObject>> objects;
+  objects.reserve(entry->targets.size());
+  Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+  for (const Entry::Target& target : entry->targets) {
+    switch (target.kind) {
+      case Entry::TargetKind::kBytecodeArray:
+        objects.push_back(bytecode);
+        break;
+      case Entry::TargetKind::kConstantPoolEntry: {
+        Tagged<Object> constant =
+            constant_pool->get(static_cast<int>(target.value));
+        // The bytecode matched, so the entry has the same type as in the
+        // isolate that produced the code.
+        if (!IsHeapObject(constant)) {
+          RecordMiss();
+          return {};
+        }
+        objects.push_back(handle(Cast<HeapObject>(constant), local_isolate));
+        break;
+      }
+      case Entry::TargetKind::kReadOnlyObject:
+        objects.push_back(handle(
+            Cast<HeapObject>(Tagged<Object>(target.value)), local_isolate));
+        break;
+    }
+  }
+
+  CodeDesc desc = entry->desc;
+  desc.embedded_objects = base::VectorOf(objects);
+
+  Handle<TrustedByteArray> bytecode_offset_table;
+  if (entry->bytecode_offset_table.empty()) {
+    bytecode_offset_table =
+        local_isolate->factory()->empty_trusted_byte_array();
+  } else {
+    bytecode_offset_table = local_isolate->factory()->NewTrustedByteArray(
+        static_cast<int>(entry->bytecode_offset_table.size()));
+    MemCopy(bytecode_offset_table->begin(),
+            entry->bytecode_offset_table.data(),
+            entry->bytecode_offset_table.size());
+  }
+
+  Factory::CodeBuilder code_builder(local_isolate, desc, CodeKind::BASELINE);
+  code_builder.set_bytecode_offset_table(bytecode_offset_table);
+  if (shared->HasInterpreterData(local_isolate)) {
+    code_builder.set_interpreter_data(
+        handle(shared->interpreter_data(local_isolate), local_isolate));
+  } else {
+    code_builder.set_interpreter_data(bytecode);
+  }
+  MaybeHandle<Code> code = code_builder.TryBuild();
+  if (!code.is_null()) RecordHit();
+  return code;
+}
+
+void BaselineCodeCache::Add(LocalIsolate* local_isolate, const Key& key,
+                            Handle<BytecodeArray> bytecode,
+                            const CodeDesc& desc,
+                            base::Vector<const uint8_t> bytecode_offset_table) {
+  DCHECK_NOT_NULL(desc.origin);
+  if (desc.unwinding_info_size != 0) return;
+  if (!HasRoomFor(static_cast<size_t>(desc.instr_size + desc.reloc_size),
+                  v8_flags.sparkplug_shared_code_cache_max_size)) {
+    return;
+  }
+
+  auto entry = std::make_shared<Entry>();
+  Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+  {
+    DisallowGarbageCollection no_gc;
+    for (RelocIterator it((CodeReference(&desc))); !it.done(); it.next()) {
+      RelocInfo::Mode mode = it.rinfo()->rmode();
+      if (RelocInfo::IsNearBuiltinEntry(mode) ||
+          RelocInfo::IsConstPool(mode) || RelocInfo::IsVeneerPool(mode) ||
+          RelocInfo::IsDeoptPosition(mode) || RelocInfo::IsDeoptReason(mode) ||
+          RelocInfo::IsDeoptId(mode) || RelocInfo::IsDeoptNodeId(mode)) {
+        // These don't depend on the isolate or on the address of the code.
+        continue;
+      }
+      if (!RelocInfo::IsEmbeddedObjectMode(mode)) return;
+
+      Tagged<HeapObject> object =
+          *it.rinfo()->target_object_handle(desc.origin);
+      if (object == *bytecode) {
+        entry->targets.push_back({Entry::TargetKind::kBytecodeArray, 0});
+        continue;
+      }
+      if (ReadOnlyHeap::IsReadOnlySpaceShared() &&
+          HeapLayout::InReadOnlySpace(object)) {
+        entry->targets.push_back(
+            {Entry::TargetKind::kReadOnlyObject, object.ptr()});
+        continue;
+      }
+      int index = -1;
+      for (int i = 0; i < constant_pool->length(); i++) {
+        if (constant_pool->get(i) == object) {
+          index = i;
+          break;
+        }
+      }
+      if (index < 0) return;
+      entry->targets.push_back({Entry::TargetKind::kConstantPoolEntry,
+                                static_cast<Address>(index)});
+    }
+
+    const uint8_t* bytecodes =
+        reinterpret_cast<const uint8_t*>(bytecode->GetFirstBytecodeAddress());
+    entry->bytecodes.assign(bytecodes, bytecodes + bytecode->length());
+    entry->frame_size = bytecode->frame_size();
+    entry->parameter_count = bytecode->parameter_count();
+    entry->constant_pool_length = constant_pool->length();
+    for (int i = 0; i < constant_pool->length(); i++) {
+      Tagged<Object> constant = constant_pool->get(i);
+      if (IsSmi(constant)) {
+        entry->smi_constants.emplace_back(i, Smi::ToInt(constant));
+      }
+    }
+  }
+  entry->short_builtin_calls =
+      local_isolate->GetMainThreadIsolateUnsafe()
+          ->is_short_builtin_calls_enabled();
+
+  // Drop the free space between the instructions and the relocation info.
+  int buffer_size = desc.instr_size + desc.reloc_size;
+  entry->buffer = std::make_unique<uint8_t[]>(buffer_size);
+  MemCopy(entry->buffer.get(), desc.buffer, desc.instr_size);
+  MemCopy(entry->buffer.get() + desc.instr_size,
+          desc.buffer + desc.reloc_offset, desc.reloc_size);
+  entry->desc = desc;
+  entry->desc.buffer = entry->buffer.get();
+  entry->desc.buffer_size = buffer_size;
+  entry->desc.reloc_offset = desc.instr_size;
+  entry->desc.origin = nullptr;
+  entry->bytecode_offset_table.assign(bytecode_offset_table.begin(),
+                                      bytecode_offset_table.end());
+
+  Insert(key, std::move(entry), v8_flags.sparkplug_shared_code_cache_max_size);
+}
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,92 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASELINE_BASELINE_CODE_CACHE_H_
+#define V8_BASELINE_BASELINE_CODE_CACHE_H_
+
+#include <optional>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/init/isolate-group-cache.h"
+
+namespace v8 {
+namespace internal {
+
+class BytecodeArray;
+class Code;
+class CodeDesc;
+class Isolate;
+class LocalIsolate;
+class SharedFunctionInfo;
+
+namespace baseline {
+
+// Entries are looked up by the hash of the function's source and the hash of
+// its bytecode. A hit additionally compares the full bytecode.
+struct BaselineCodeCacheKey {
+  uint32_t source_hash;
+  uint32_t bytecode_hash;
+
+  bool operator==(const BaselineCodeCacheKey& other) const {
+    return source_hash == other.source_hash &&
+           bytecode_hash == other.bytecode_hash;
+  }
+  size_t Hash() const;
+};
+
+struct BaselineCodeCacheEntry;
+
+// A cache of Sparkplug code that is shared between all isolates of an
+// IsolateGroup. Sparkplug code only depends on the bytecode of a function, so
+// isolates that run the same scripts (e.g. several workers or iframes loading
+// the same library) generate identical machine code for it.
+//
+// Code objects themselves are per-isolate, so the cache does not store them.
+// Instead, it keeps a copy of the assembler output together with a symbolic
+// description of all heap objects embedded into it (the function's bytecode
+// array, entries of its constant pool, or read-only roots). Building baseline
+// code from a cache entry then only requires copying the instructions and
+// re-resolving the embedded objects in the requesting isolate, instead of
+// running the baseline compiler again.
+//
+// Code that references anything else (e.g. external references or other code
+// objects) is not cached.
+class V8_EXPORT_PRIVATE BaselineCodeCache final
+    : public IsolateGroupCache<BaselineCodeCacheKey, BaselineCodeCacheEntry> {
+ public:
+  using Key = BaselineCodeCacheKey;
+
+  BaselineCodeCache();
+  ~BaselineCodeCache();
+
+  // Computes the cache key for {shared}. Returns an empty optional if {shared}
+  // has no source that could be hashed. Must be called on the main thread.
+  static std::optional<Key> ComputeKey(Isolate* isolate,
+                                       Tagged<SharedFunctionInfo> shared,
+                                       Tagged<BytecodeArray> bytecode);
+
+  // Builds a BASELINE code object for {bytecode} from the entry for {key}, or
+  // returns an empty handle if there is no matching entry.
+  MaybeHandle<Code> TryBuild(LocalIsolate* local_isolate, const Key& key,
+                             Handle<SharedFunctionInfo> shared,
+                             Handle<BytecodeArray> bytecode);
+
+  // Adds the code described by {desc} (which must still be backed by its
+  // assembler) to the cache, unless it embeds objects that can't be
+  // re-resolved in other isolates or the cache is full.
+  void Add(LocalIsolate* local_isolate, const Key& key,
+           Handle<BytecodeArray> bytecode, const CodeDesc& desc,
+           base::Vector<const uint8_t> bytecode_offset_table);
+
+ private:
+  using Entry = BaselineCodeCacheEntry;
+};
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BASELINE_BASELINE_CODE_CACHE_H_
@@ -22,6 +22,7 @@
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/init/isolate-group.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags-and-tokens.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -337,6 +338,14 @@ MaybeHandle<Code> BaselineCompiler::Build() {
   CodeDesc desc;
   __ GetCode(local_isolate_, &desc);
 
+  if (code_cache_key_.has_value()) {
+    local_isolate_->GetMainThreadIsolateUnsafe()
+        ->isolate_group()
+        ->baseline_code_cache()
+        ->Add(local_isolate_, *code_cache_key_, bytecode_, desc,
+              bytecode_offset_table_builder_.bytes());
+  }
+
   // Allocate the bytecode offset table.
   Handle<TrustedByteArray> bytecode_offset_table =
       bytecode_offset_table_builder_.ToBytecodeOffsetTable(local_isolate_);
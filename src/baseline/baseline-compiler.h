@@ -10,6 +10,7 @@
 #include "src/base/threaded-list.h"
 #include "src/base/vlq.h"
 #include "src/baseline/baseline-assembler.h"
+#include "src/baseline/baseline-code-cache.h"
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/interpreter/bytecode-array-iterator.h"
@@ -42,6 +43,8 @@ class BytecodeOffsetTableBuilder {
 
   void Reserve(size_t size) { bytes_.reserve(size); }
 
+  base::Vector<const uint8_t> bytes() const { return base::VectorOf(bytes_); }
+
  private:
   size_t previous_pc_ = 0;
   std::vector<uint8_t> bytes_;
@@ -55,6 +58,12 @@ class BaselineCompiler {
 
   void GenerateCode();
   MaybeHandle<Code> Build();
+
+  // Makes Build() add the generated code to the isolate group's
+  // BaselineCodeCache under {key}.
+  void set_code_cache_key(const BaselineCodeCache::Key& key) {
+    code_cache_key_ = key;
+  }
   static int EstimateInstructionSize(Tagged<BytecodeArray> bytecode);
 
  private:
@@ -168,6 +177,7 @@ class BaselineCompiler {
   BaselineAssembler basm_;
   interpreter::BytecodeArrayIterator iterator_;
   BytecodeOffsetTableBuilder bytecode_offset_table_builder_;
+  std::optional<BaselineCodeCache::Key> code_cache_key_;
 
   // Mark location as a jump target reachable via indirect branches, required
   // for CFI.
@@ -10,9 +10,11 @@
 #ifdef V8_ENABLE_SPARKPLUG
 
 #include "src/baseline/baseline-assembler-inl.h"
+#include "src/baseline/baseline-code-cache.h"
 #include "src/baseline/baseline-compiler.h"
 #include "src/debug/debug.h"
 #include "src/heap/factory-inl.h"
+#include "src/init/isolate-group.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/script-inl.h"
 
@@ -58,9 +60,22 @@ MaybeHandle<Code> GenerateBaselineCode(Isolate* isolate,
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileBaseline);
   Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
   LocalIsolate* local_isolate = isolate->main_thread_local_isolate();
-  baseline::BaselineCompiler compiler(local_isolate, shared, bytecode);
-  compiler.GenerateCode();
-  MaybeHandle<Code> code = compiler.Build();
+  std::optional<baseline::BaselineCodeCache::Key> cache_key;
+  MaybeHandle<Code> code;
+  if (v8_flags.sparkplug_share_code) {
+    cache_key =
+        baseline::BaselineCodeCache::ComputeKey(isolate, *shared, *bytecode);
+    if (cache_key.has_value()) {
+      code = isolate->isolate_group()->baseline_code_cache()->TryBuild(
+          local_isolate, *cache_key, shared, bytecode);
+    }
+  }
+  if (code.is_null()) {
+    baseline::BaselineCompiler compiler(local_isolate, shared, bytecode);
+    if (cache_key.has_value()) compiler.set_code_cache_key(*cache_key);
+    compiler.GenerateCode();
+    code = compiler.Build();
+  }
   if (v8_flags.print_code && !code.is_null()) {
     Print(*code.ToHandleChecked());
   }
@@ -21,6 +21,7 @@
 #include "src/objects/module-inl.h"
 #include "src/objects/property-details.h"
 #include "src/objects/prototype.h"
+#include "src/snapshot/snapshot.h"
 
 namespace v8 {
 namespace internal {
@@ -227,6 +228,25 @@ Handle<AccessorInfo> Accessors::MakeArrayLengthInfo(Isolate* isolate) {
                       &ArrayLengthGetter, &ArrayLengthSetter);
 }
 
+//
+// Accessors::LazyContextProperty
+//
+
+void Accessors::LazyContextPropertyGetter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
+  HandleScope scope(isolate);
+  Handle<JSObject> holder = Cast<JSObject>(Utils::OpenHandle(*info.Holder()));
+  if (IsJSGlobalObject(*holder)) {
+    DirectHandle<NativeContext> native_context(
+        Cast<JSGlobalObject>(*holder)->native_context(), isolate);
+    Snapshot::MaterializeLazyContextProperties(isolate, native_context);
+  }
+  Handle<Object> result =
+      JSReceiver::GetDataProperty(isolate, holder, Utils::OpenHandle(*name));
+  info.GetReturnValue().Set(Utils::ToLocal(result));
+}
+
 //
 // Accessors::ModuleNamespaceEntry
 //
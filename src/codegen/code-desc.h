@@ -5,6 +5,7 @@
 #ifndef V8_CODEGEN_CODE_DESC_H_
 #define V8_CODEGEN_CODE_DESC_H_
 
+#include "src/base/vector.h"
 #include "src/common/globals.h"
 
 namespace v8 {
@@ -105,6 +106,11 @@ class CodeDesc {
   }
 
   Assembler* origin = nullptr;
+
+  // Code that was not produced by an assembler in this isolate (see
+  // baseline::BaselineCodeCache) has no {origin} to resolve embedded objects
+  // from. Instead, they are provided here in relocation order.
+  base::Vector<const IndirectHandle<HeapObject>> embedded_objects;
 };
 
 }  // namespace internal
@@ -20,6 +20,7 @@
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/codegen/script-details.h"
+#include "src/codegen/shared-script-cache.h"
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -45,6 +46,7 @@
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/parked-scope-inl.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
@@ -62,6 +64,7 @@
 #include "src/parsing/pending-compilation-error-handler.h"
 #include "src/parsing/scanner-character-streams.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/tasks/task-utils.h"
 #include "src/tracing/traced-value.h"
 #include "src/utils/ostreams.h"
 #include "src/zone/zone-list-inl.h"  // crbug.com/v8/8816
@@ -1122,7 +1125,7 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
   DCHECK_EQ(compilation_info->code_kind(), CodeKind::TURBOFAN_JS);
   DirectHandle<JSFunction> function = compilation_info->closure();
 
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->MakeRoomFor(job.get())) {
     if (v8_flags.trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       ShortPrint(*function);
@@ -2876,6 +2879,11 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (shared_info->bytecode_was_flushed()) {
+    isolate->counters()->recompiled_after_flush()->Increment();
+    shared_info->set_bytecode_was_flushed(false);
+  }
+
   Handle<Script> script(Cast<Script>(shared_info->script()), isolate);
 
   // Set up parse info.
@@ -3805,6 +3813,77 @@ ScriptCompiler::InMemoryCacheResult CategorizeLookupResult(
              ? ScriptCompiler::InMemoryCacheResult::kPartial
              : ScriptCompiler::InMemoryCacheResult::kMiss;
 }
+
+// Deserializes the code cache that another isolate of the group produced for
+// the script, if there is one.
+MaybeHandle<SharedFunctionInfo> LookupSharedScriptCache(
+    Isolate* isolate, const SharedScriptCache::Key& key, Handle<String> source,
+    const ScriptDetails& script_details, MaybeHandle<Script> maybe_script) {
+  SharedScriptCache* cache = isolate->isolate_group()->shared_script_cache();
+  std::shared_ptr<const std::vector<uint8_t>> code_cache =
+      cache->Lookup(key, source);
+  if (!code_cache) return {};
+  NestedTimedHistogramScope timer(isolate->counters()->compile_deserialize());
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileDeserialize);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileDeserialize");
+  // The entry keeps the data alive, so it doesn't need to be copied.
+  AlignedCachedData cached_data(code_cache->data(),
+                                static_cast<int>(code_cache->size()));
+  MaybeHandle<SharedFunctionInfo> maybe_result = CodeSerializer::Deserialize(
+      isolate, &cached_data, source, script_details, maybe_script);
+  if (cached_data.rejected()) {
+    // E.g. the isolate that produced the entry ran with different flags. The
+    // entry is dropped, so that this isolate's result can replace it.
+    cache->RecordRejection(key);
+  }
+  return maybe_result;
+}
+
+// Adds the compiled script to the cache that is shared by the isolates of the
+// group. Serializing it takes about as long as deserializing it, so it is
+// done in a task instead of as part of the compile that is waited for.
+void AddToSharedScriptCache(Isolate* isolate,
+                            const SharedScriptCache::Key& key,
+                            DirectHandle<SharedFunctionInfo> result) {
+  if (isolate->isolate_group()->shared_script_cache()->Contains(key)) return;
+  Handle<SharedFunctionInfo> info = isolate->global_handles()->Create(*result);
+  V8::GetCurrentPlatform()
+      ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(isolate))
+      ->PostTask(MakeCancelableTask(isolate, [isolate, key, info] {
+        HandleScope scope(isolate);
+        Handle<SharedFunctionInfo> result(*info, isolate);
+        GlobalHandles::Destroy(info.location());
+        SharedScriptCache* cache =
+            isolate->isolate_group()->shared_script_cache();
+        // Another isolate may have added the script in the meantime.
+        if (cache->Contains(key)) return;
+        std::unique_ptr<ScriptCompiler::CachedData> data(
+            CodeSerializer::Serialize(isolate, result));
+        if (!data || !cache->HasRoomFor(data->length)) return;
+        Handle<String> source = String::Flatten(
+            isolate,
+            handle(Cast<String>(Cast<Script>(result->script())->source()),
+                   isolate));
+        cache->Add(key, source, std::move(data));
+      }));
+}
+
+// Adds a script that was compiled by a streaming compile task to the shared
+// cache, like GetSharedFunctionInfoForScriptImpl does for the scripts that it
+// compiles.
+void MaybeAddToSharedScriptCache(Isolate* isolate, Handle<String> source,
+                                 const ScriptDetails& script_details,
+                                 DirectHandle<SharedFunctionInfo> result) {
+  if (!v8_flags.isolate_group_script_cache || !v8_flags.compilation_cache) {
+    return;
+  }
+  std::optional<SharedScriptCache::Key> shared_cache_key =
+      SharedScriptCache::ComputeKey(isolate, source, script_details);
+  if (shared_cache_key.has_value()) {
+    AddToSharedScriptCache(isolate, *shared_cache_key, result);
+  }
+}
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
@@ -3851,6 +3930,7 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
   MaybeHandle<SharedFunctionInfo> maybe_result;
   MaybeHandle<Script> maybe_script;
   IsCompiledScope is_compiled_scope;
+  std::optional<SharedScriptCache::Key> shared_cache_key;
   if (use_compilation_cache) {
     bool can_consume_code_cache =
         compile_options & ScriptCompiler::kConsumeCodeCache;
@@ -3917,6 +3997,24 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else if (v8_flags.isolate_group_script_cache &&
+               v8_flags.compilation_cache && natives == NOT_NATIVES_CODE) {
+      // Then check whether another isolate of the group compiled the script.
+      shared_cache_key =
+          SharedScriptCache::ComputeKey(isolate, source, script_details);
+      if (shared_cache_key.has_value()) {
+        maybe_result = LookupSharedScriptCache(
+            isolate, *shared_cache_key, source, script_details, maybe_script);
+        Handle<SharedFunctionInfo> result;
+        if (maybe_result.ToHandle(&result)) {
+          is_compiled_scope = result->is_compiled_scope(isolate);
+          if (is_compiled_scope.is_compiled()) {
+            compilation_cache->PutScript(source, language_mode, result);
+          } else {
+            maybe_result = {};
+          }
+        }
+      }
     }
   }
 
@@ -3957,6 +4055,9 @@ MaybeHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      if (shared_cache_key.has_value()) {
+        AddToSharedScriptCache(isolate, *shared_cache_key, result);
+      }
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -4211,6 +4312,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
                    "V8.StreamingFinalization.AddToCache");
       compilation_cache->PutScript(source, task->flags().outer_language_mode(),
                                    result);
+      MaybeAddToSharedScriptCache(isolate, source, script_details, result);
     }
   }
 
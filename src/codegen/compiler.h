@@ -483,8 +483,18 @@ class TurbofanCompilationJob : public OptimizedCompilationJob {
   // Intended for use as a globally unique id in trace events.
   uint64_t trace_id() const;
 
+  // Time between queueing the job for concurrent compilation and a background
+  // thread picking it up.
+  double queue_wait_in_ms() const {
+    return time_spent_in_queue_.InMillisecondsF();
+  }
+  void set_time_spent_in_queue(base::TimeDelta time) {
+    time_spent_in_queue_ = time;
+  }
+
  private:
   OptimizedCompilationInfo* const compilation_info_;
+  base::TimeDelta time_spent_in_queue_;
 };
 
 class FinalizeUnoptimizedCompilationData {
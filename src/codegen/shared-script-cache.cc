@@ -0,0 +1,144 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/shared-script-cache.h"
+
+#include "src/base/functional.h"
+#include "src/codegen/script-details.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/strings/string-hasher-inl.h"
+
+namespace v8 {
+namespace internal {
+
+struct SharedScriptCacheEntry {
+  bool Matches(const String::FlatContent& content) const {
+    if (content.IsOneByte() != source_is_one_byte) return false;
+    base::Vector<const uint8_t> bytes =
+        content.IsOneByte()
+            ? content.ToOneByteVector()
+            : base::Vector<const uint8_t>::cast(content.ToUC16Vector());
+    return bytes.size() == source.size() &&
+           memcmp(bytes.begin(), source.data(), source.size()) == 0;
+  }
+
+  size_t size_in_bytes() const {
+    return sizeof(*this) + source.size() + code_cache->size();
+  }
+
+  // The raw characters of the source, to rule out hash collisions.
+  std::vector<uint8_t> source;
+  bool source_is_one_byte;
+  // The output of CodeSerializer::Serialize.
+  std::shared_ptr<const std::vector<uint8_t>> code_cache;
+};
+
+namespace {
+
+// Hashes with a fixed seed, since the hash seed of the isolate is not
+// necessarily shared with the other isolates in the group.
+uint32_t HashFlatContent(const String::FlatContent& content) {
+  return content.IsOneByte()
+             ? StringHasher::HashSequentialString(
+                   content.ToOneByteVector().begin(), content.length(),
+                   kZeroHashSeed)
+             : StringHasher::HashSequentialString(
+                   content.ToUC16Vector().begin(), content.length(),
+                   kZeroHashSeed);
+}
+
+}  // namespace
+
+size_t SharedScriptCacheKey::Hash() const {
+  return base::hash_combine(source_hash, name_hash, source_length, line_offset,
+                            column_offset, origin_flags);
+}
+
+SharedScriptCache::SharedScriptCache() = default;
+SharedScriptCache::~SharedScriptCache() = default;
+
+// static
+std::optional<SharedScriptCache::Key> SharedScriptCache::ComputeKey(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  // Host-defined options and wrapped arguments are heap objects of the
+  // compiling isolate, which the cached script would otherwise bake in.
+  Handle<Object> host_defined_options;
+  if (script_details.host_defined_options.ToHandle(&host_defined_options) &&
+      !(IsFixedArray(*host_defined_options) &&
+        Cast<FixedArray>(*host_defined_options)->length() == 0)) {
+    return {};
+  }
+  if (!script_details.wrapped_arguments.is_null()) return {};
+
+  uint32_t name_hash = 0;
+  Handle<Object> name;
+  if (script_details.name_obj.ToHandle(&name) && IsString(*name)) {
+    Handle<String> name_string = String::Flatten(isolate, Cast<String>(name));
+    DisallowGarbageCollection no_gc;
+    name_hash = HashFlatContent(name_string->GetFlatContent(no_gc));
+  }
+
+  source = String::Flatten(isolate, source);
+  DisallowGarbageCollection no_gc;
+  return Key{HashFlatContent(source->GetFlatContent(no_gc)),
+             name_hash,
+             static_cast<int>(source->length()),
+             script_details.line_offset,
+             script_details.column_offset,
+             script_details.origin_options.Flags()};
+}
+
+std::shared_ptr<const std::vector<uint8_t>> SharedScriptCache::Lookup(
+    const Key& key, Handle<String> source) {
+  std::shared_ptr<const Entry> entry = Find(key);
+  DisallowGarbageCollection no_gc;
+  if (!entry || !entry->Matches(source->GetFlatContent(no_gc))) {
+    RecordMiss();
+    return {};
+  }
+  RecordHit();
+  return entry->code_cache;
+}
+
+void SharedScriptCache::RecordRejection(const Key& key) {
+  rejections_++;
+  Remove(key);
+}
+
+void SharedScriptCache::Clear() {
+  IsolateGroupCache::Clear();
+  rejections_ = 0;
+}
+
+void SharedScriptCache::Add(const Key& key, Handle<String> source,
+                            std::unique_ptr<ScriptCompiler::CachedData> data) {
+  auto entry = std::make_shared<Entry>();
+  {
+    DisallowGarbageCollection no_gc;
+    String::FlatContent content = source->GetFlatContent(no_gc);
+    DCHECK(content.IsFlat());
+    entry->source_is_one_byte = content.IsOneByte();
+    base::Vector<const uint8_t> bytes =
+        content.IsOneByte()
+            ? content.ToOneByteVector()
+            : base::Vector<const uint8_t>::cast(content.ToUC16Vector());
+    entry->source.assign(bytes.begin(), bytes.end());
+  }
+  entry->code_cache = std::make_shared<const std::vector<uint8_t>>(
+      data->data, data->data + data->length);
+
+  Insert(key, std::move(entry), v8_flags.isolate_group_script_cache_max_size);
+}
+
+bool SharedScriptCache::HasRoomFor(size_t size) const {
+  return IsolateGroupCache::HasRoomFor(
+      size, v8_flags.isolate_group_script_cache_max_size);
+}
+
+}  // namespace internal
+}  // namespace v8
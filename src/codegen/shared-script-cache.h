@@ -0,0 +1,101 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_SHARED_SCRIPT_CACHE_H_
+#define V8_CODEGEN_SHARED_SCRIPT_CACHE_H_
+
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "include/v8-script.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/init/isolate-group-cache.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class String;
+struct ScriptDetails;
+
+// Entries are looked up by the hash of the source and the script origin. A
+// hit additionally compares the full source.
+struct SharedScriptCacheKey {
+  uint32_t source_hash;
+  uint32_t name_hash;
+  int source_length;
+  int line_offset;
+  int column_offset;
+  int origin_flags;
+
+  bool operator==(const SharedScriptCacheKey& other) const {
+    return source_hash == other.source_hash && name_hash == other.name_hash &&
+           source_length == other.source_length &&
+           line_offset == other.line_offset &&
+           column_offset == other.column_offset &&
+           origin_flags == other.origin_flags;
+  }
+  size_t Hash() const;
+};
+
+struct SharedScriptCacheEntry;
+
+// A cache of compiled top-level scripts that is shared between all isolates
+// of an IsolateGroup, complementing the per-isolate CompilationCacheScript.
+// Isolates that load the same scripts (e.g. several workers running the same
+// bundle) then only need to compile each script once per group.
+//
+// SharedFunctionInfos and bytecode live on the (per-isolate) heap and can't
+// be referenced from other isolates, so entries hold the code cache that
+// CodeSerializer produced for the script in the isolate that compiled it
+// first. Other isolates deserialize it like an embedder-provided code cache,
+// and compile normally if it gets rejected.
+class V8_EXPORT_PRIVATE SharedScriptCache final
+    : public IsolateGroupCache<SharedScriptCacheKey, SharedScriptCacheEntry> {
+ public:
+  using Key = SharedScriptCacheKey;
+
+  SharedScriptCache();
+  ~SharedScriptCache();
+
+  // Computes the cache key for compiling {source} with {script_details}.
+  // Returns an empty optional if the script can't be shared, e.g. because it
+  // has host-defined options that are specific to the isolate.
+  static std::optional<Key> ComputeKey(Isolate* isolate,
+                                       Handle<String> source,
+                                       const ScriptDetails& script_details);
+
+  // Returns the code cache of the entry for {key}, or an empty pointer if
+  // there is no entry with the same source.
+  std::shared_ptr<const std::vector<uint8_t>> Lookup(const Key& key,
+                                                     Handle<String> source);
+
+  // Records that the code cache of the entry for {key} was rejected when it
+  // was deserialized, and drops the entry.
+  void RecordRejection(const Key& key);
+  size_t rejections() const { return rejections_.load(); }
+
+  void Clear();
+
+  // Adds the code cache in {data} for {source}, unless the cache is full.
+  void Add(const Key& key, Handle<String> source,
+           std::unique_ptr<ScriptCompiler::CachedData> data);
+
+  // Whether a code cache of {size} bytes would still fit into the cache, to
+  // avoid copying the source of scripts that would be dropped anyway.
+  bool HasRoomFor(size_t size) const;
+
+ private:
+  using Entry = SharedScriptCacheEntry;
+
+  std::atomic<size_t> rejections_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_SHARED_SCRIPT_CACHE_H_
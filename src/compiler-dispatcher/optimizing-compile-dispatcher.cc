@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/optimized-compilation-info.h"
@@ -15,7 +17,8 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -43,10 +46,11 @@ class OptimizingCompileDispatcher::CompileTask : public v8::JobTask {
       while (!delegate->ShouldYield()) {
         TurbofanCompilationJob* job = dispatcher_->NextInput(&local_isolate);
         if (!job) break;
-        TRACE_EVENT_WITH_FLOW0(
+        TRACE_EVENT_WITH_FLOW1(
             TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.OptimizeBackground",
             job->trace_id(),
-            TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT);
+            TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT,
+            "queue_wait_in_ms", job->queue_wait_in_ms());
 
         if (dispatcher_->recompilation_delay_ != 0) {
           base::OS::Sleep(base::TimeDelta::FromMilliseconds(
@@ -121,15 +125,75 @@ void OptimizingCompileDispatcher::FlushOutputQueue() {
   }
 }
 
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Dequeue() {
+  base::MutexGuard access(&mutex_);
+  if (queue_.empty()) return nullptr;
+  base::TimeTicks now = clock_();
+  auto best = queue_.begin();
+  for (auto it = queue_.begin() + 1; it != queue_.end(); ++it) {
+    // On ties, the job that was queued first wins.
+    if (EffectivePriority(*it, now) > EffectivePriority(*best, now) ||
+        (EffectivePriority(*it, now) == EffectivePriority(*best, now) &&
+         it->queued_at < best->queued_at)) {
+      best = it;
+    }
+  }
+  TurbofanCompilationJob* job = best->job;
+  DCHECK_NOT_NULL(job);
+  job->set_time_spent_in_queue(now - best->queued_at);
+  queue_.erase(best);
+  return job;
+}
+
+void OptimizingCompileDispatcherQueue::Enqueue(TurbofanCompilationJob* job,
+                                               int64_t priority) {
+  base::MutexGuard access(&mutex_);
+  DCHECK_LT(static_cast<int>(queue_.size()), capacity_);
+  queue_.push_back({job, priority, clock_()});
+}
+
+TurbofanCompilationJob*
+OptimizingCompileDispatcherQueue::EvictLowerPriorityThan(int64_t priority) {
+  base::MutexGuard access(&mutex_);
+  if (queue_.empty()) return nullptr;
+  base::TimeTicks now = clock_();
+  auto worst = queue_.begin();
+  for (auto it = queue_.begin() + 1; it != queue_.end(); ++it) {
+    if (EffectivePriority(*it, now) < EffectivePriority(*worst, now)) {
+      worst = it;
+    }
+  }
+  if (EffectivePriority(*worst, now) >= priority) return nullptr;
+  TurbofanCompilationJob* job = worst->job;
+  queue_.erase(worst);
+  return job;
+}
+
+std::vector<TurbofanCompilationJob*>
+OptimizingCompileDispatcherQueue::RemoveJobsFor(Tagged<JSFunction> function) {
+  base::MutexGuard access(&mutex_);
+  std::vector<TurbofanCompilationJob*> removed;
+  auto it = std::remove_if(queue_.begin(), queue_.end(),
+                           [&](const Entry& entry) {
+                             if (*entry.job->compilation_info()->closure() !=
+                                 function) {
+                               return false;
+                             }
+                             removed.push_back(entry.job);
+                             return true;
+                           });
+  queue_.erase(it, queue_.end());
+  return removed;
+}
+
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
-  while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
+  for (const Entry& entry : queue_) {
+    std::unique_ptr<TurbofanCompilationJob> job(entry.job);
     DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
     Compiler::DisposeTurbofanCompilationJob(isolate, job.get());
   }
+  queue_.clear();
 }
 
 void OptimizingCompileDispatcher::FlushInputQueue() {
@@ -190,6 +254,12 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
     OptimizedCompilationInfo* info = job->compilation_info();
     DirectHandle<JSFunction> function(*info->closure(), isolate_);
 
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Compilation job for ");
+      ShortPrint(*function);
+      PrintF(" waited %.3f ms in the queue.\n", job->queue_wait_in_ms());
+    }
+
     // If another racing task has already finished compiling and installing the
     // requested code kind on the function, throw out the current job.
     if (!info->is_osr() &&
@@ -212,10 +282,55 @@ bool OptimizingCompileDispatcher::HasJobs() {
   return job_handle_->IsActive() || !output_queue_.empty();
 }
 
+int64_t OptimizingCompileDispatcher::PriorityOf(
+    TurbofanCompilationJob* job) const {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  OptimizedCompilationInfo* info = job->compilation_info();
+  Tagged<JSFunction> function = *info->closure();
+  int64_t priority = 0;
+  if (function->has_feedback_vector()) {
+    priority = function->feedback_vector()->invocation_count(kRelaxedLoad);
+  }
+  if (info->is_osr()) {
+    priority += OptimizingCompileDispatcherQueue::kOsrPriorityBoost;
+  }
+  return priority;
+}
+
+bool OptimizingCompileDispatcher::MakeRoomFor(TurbofanCompilationJob* job) {
+  if (input_queue_.IsAvailable()) return true;
+  std::unique_ptr<TurbofanCompilationJob> evicted(
+      input_queue_.EvictLowerPriorityThan(PriorityOf(job)));
+  if (!evicted) return false;
+  if (v8_flags.trace_concurrent_recompilation) {
+    PrintF("  ** Evicting ");
+    ShortPrint(*evicted->compilation_info()->closure());
+    PrintF(" from the compilation queue in favor of ");
+    ShortPrint(*job->compilation_info()->closure());
+    PrintF(".\n");
+  }
+  Compiler::DisposeTurbofanCompilationJob(isolate_, evicted.get());
+  return true;
+}
+
+void OptimizingCompileDispatcher::CancelJobsFor(Tagged<JSFunction> function) {
+  std::vector<TurbofanCompilationJob*> jobs =
+      input_queue_.RemoveJobsFor(function);
+  for (TurbofanCompilationJob* raw_job : jobs) {
+    std::unique_ptr<TurbofanCompilationJob> job(raw_job);
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Cancelling queued compilation job for ");
+      ShortPrint(function);
+      PrintF(".\n");
+    }
+    Compiler::DisposeTurbofanCompilationJob(isolate_, job.get());
+  }
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(input_queue_.IsAvailable());
-  input_queue_.Enqueue(job);
+  input_queue_.Enqueue(job, PriorityOf(job));
   if (job_handle_->UpdatePriorityEnabled()) {
     job_handle_->UpdatePriority(isolate_->EfficiencyModeEnabledForTiering()
                                     ? kEfficiencyTaskPriority
@@ -227,13 +342,10 @@ void OptimizingCompileDispatcher::QueueForOptimization(
 void OptimizingCompileDispatcherQueue::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   base::MutexGuard access(&mutex_);
-  if (length_ > 1) {
-    for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
-          function) {
-        std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
-        return;
-      }
+  for (Entry& entry : queue_) {
+    if (*entry.job->compilation_info()->shared_info() == function) {
+      entry.priority = kMaxPriority;
+      return;
     }
   }
 }
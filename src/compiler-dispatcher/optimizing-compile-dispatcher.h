@@ -6,10 +6,13 @@
 #define V8_COMPILER_DISPATCHER_OPTIMIZING_COMPILE_DISPATCHER_H_
 
 #include <atomic>
+#include <limits>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/parked-scope.h"
@@ -18,64 +21,81 @@
 namespace v8 {
 namespace internal {
 
+class JSFunction;
 class LocalHeap;
 class TurbofanCompilationJob;
 class RuntimeCallStats;
 class SharedFunctionInfo;
 
-// Circular queue of incoming recompilation tasks (including OSR).
+// Queue of incoming recompilation tasks (including OSR). Jobs are dequeued in
+// order of their priority rather than in FIFO order: OSR jobs come first, then
+// jobs for the functions that were invoked most often by the time they were
+// queued. The priority of a job grows while it waits, so that jobs for
+// lukewarm functions are not starved by a steady stream of hotter ones.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
+  // Priority of jobs that were explicitly prioritized by the embedder.
+  static constexpr int64_t kMaxPriority = std::numeric_limits<int32_t>::max();
+  // Added to the priority of OSR jobs, since the function is already stuck in
+  // a long-running loop.
+  static constexpr int64_t kOsrPriorityBoost = 1 << 20;
+  // How much the priority of a job grows per millisecond it waits.
+  static constexpr int64_t kAgingPerMillisecond = 64;
+
   inline bool IsAvailable() {
     base::MutexGuard access(&mutex_);
-    return length_ < capacity_;
+    return static_cast<int>(queue_.size()) < capacity_;
   }
 
   inline int Length() {
     base::MutexGuard access_queue(&mutex_);
-    return length_;
+    return static_cast<int>(queue_.size());
   }
 
-  explicit OptimizingCompileDispatcherQueue(int capacity)
-      : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+  // Returns the current time. Tests pass a fake clock so that the aging of
+  // queued jobs does not depend on how long the test takes.
+  using Clock = base::TimeTicks (*)();
+
+  explicit OptimizingCompileDispatcherQueue(
+      int capacity, Clock clock = &base::TimeTicks::Now)
+      : capacity_(capacity), clock_(clock) {
+    queue_.reserve(capacity_);
   }
 
-  ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
+  // Removes and returns the job with the highest effective priority.
+  TurbofanCompilationJob* Dequeue();
 
-  TurbofanCompilationJob* Dequeue() {
-    base::MutexGuard access(&mutex_);
-    if (length_ == 0) return nullptr;
-    TurbofanCompilationJob* job = queue_[QueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
-    return job;
-  }
+  void Enqueue(TurbofanCompilationJob* job, int64_t priority);
 
-  void Enqueue(TurbofanCompilationJob* job) {
-    base::MutexGuard access(&mutex_);
-    DCHECK_LT(length_, capacity_);
-    queue_[QueueIndex(length_)] = job;
-    length_++;
-  }
+  // Removes and returns the job with the lowest effective priority if it is
+  // lower than {priority}, or nullptr if there is no such job. The caller is
+  // responsible for disposing the returned job.
+  TurbofanCompilationJob* EvictLowerPriorityThan(int64_t priority);
+
+  // Removes and returns the jobs for {function} that have not been picked up
+  // by a background thread yet. The caller is responsible for disposing them.
+  std::vector<TurbofanCompilationJob*> RemoveJobsFor(
+      Tagged<JSFunction> function);
 
   void Flush(Isolate* isolate);
 
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
  private:
-  inline int QueueIndex(int i) {
-    int result = (i + shift_) % capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, capacity_);
-    return result;
+  struct Entry {
+    TurbofanCompilationJob* job;
+    int64_t priority;
+    base::TimeTicks queued_at;
+  };
+
+  static int64_t EffectivePriority(const Entry& entry, base::TimeTicks now) {
+    return entry.priority +
+           (now - entry.queued_at).InMilliseconds() * kAgingPerMillisecond;
   }
 
-  TurbofanCompilationJob** queue_;
-  int capacity_;
-  int length_;
-  int shift_;
+  std::vector<Entry> queue_;
+  const int capacity_;
+  const Clock clock_;
   base::Mutex mutex_;
 };
 
@@ -89,6 +109,13 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   void Flush(BlockingBehavior blocking_behavior);
   // Takes ownership of |job|.
   void QueueForOptimization(TurbofanCompilationJob* job);
+  // If the input queue is full, tries to make room for |job| by evicting a
+  // queued job of lower priority. Returns whether |job| can be queued.
+  bool MakeRoomFor(TurbofanCompilationJob* job);
+  // Drops the queued jobs for |function| that have not started yet, e.g.
+  // because they were prepared with feedback that has since been invalidated
+  // by a deopt.
+  void CancelJobsFor(Tagged<JSFunction> function);
   void AwaitCompileTasks();
   void InstallOptimizedFunctions();
 
@@ -118,6 +145,7 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   static constexpr TaskPriority kEfficiencyTaskPriority =
       TaskPriority::kBestEffort;
 
+  int64_t PriorityOf(TurbofanCompilationJob* job) const;
   void FlushQueues(BlockingBehavior blocking_behavior);
   void FlushInputQueue();
   void FlushOutputQueue();
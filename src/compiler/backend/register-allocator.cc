@@ -1167,6 +1167,13 @@ void RegisterAllocationData::PhiMapValue::CommitAssignment(
   }
 }
 
+// static
+bool RegisterAllocationData::UseFastMode(const InstructionSequence* code) {
+  return v8_flags.turbo_fast_register_allocation_threshold > 0 &&
+         code->VirtualRegisterCount() >=
+             v8_flags.turbo_fast_register_allocation_threshold;
+}
+
 RegisterAllocationData::RegisterAllocationData(
     const RegisterConfiguration* config, Zone* zone, Frame* frame,
     InstructionSequence* code, TickCounter* tick_counter,
@@ -1196,7 +1203,8 @@ RegisterAllocationData::RegisterAllocationData(
       spill_state_(code->InstructionBlockCount(), ZoneVector<LiveRange*>(zone),
                    zone),
       tick_counter_(tick_counter),
-      slot_for_const_range_(zone) {
+      slot_for_const_range_(zone),
+      is_fast_mode_(UseFastMode(code)) {
   if (kFPAliasing == AliasingKind::kCombine) {
     fixed_float_live_ranges_.resize(
         kNumberOfFixedRangesPerRegister * this->config()->num_float_registers(),
@@ -2542,6 +2550,8 @@ bool LiveRangeBuilder::NextIntervalStartsInDifferentBlocks(
 #endif
 
 void BundleBuilder::BuildBundles() {
+  // Bundles only serve as hints to reduce moves and spill slots around phis.
+  if (data()->is_fast_mode()) return;
   TRACE("Build bundles\n");
   // Process the blocks in reverse order.
   for (int block_id = code()->InstructionBlockCount() - 1; block_id >= 0;
@@ -2797,7 +2807,7 @@ LifetimePosition RegisterAllocator::FindOptimalSplitPos(LifetimePosition start,
   const InstructionBlock* start_block = GetInstructionBlock(code(), start);
   const InstructionBlock* end_block = GetInstructionBlock(code(), end);
 
-  if (end_block == start_block) {
+  if (end_block == start_block || data()->is_fast_mode()) {
     // The interval is split in the same basic block. Split at the latest
     // possible position.
     return end;
@@ -3750,7 +3760,8 @@ void LinearScanAllocator::AllocateRegisters() {
                                            current_block->predecessors()[0])) {
             chosen_predecessor = current_block->predecessors()[1];
           } else if (!ConsiderBlockForControlFlow(
-                         current_block, current_block->predecessors()[1])) {
+                         current_block, current_block->predecessors()[1]) ||
+                     data()->is_fast_mode()) {
             chosen_predecessor = current_block->predecessors()[0];
           } else {
             chosen_predecessor = ChooseOneOfTwoPredecessorStates(
@@ -3759,8 +3770,23 @@ void LinearScanAllocator::AllocateRegisters() {
           no_change_required = pick_state_from(chosen_predecessor, to_be_live);
 
         } else {
-          // Merge at the end of, e.g., a switch.
-          ComputeStateFromManyPredecessors(current_block, to_be_live);
+          // Merge at the end of, e.g., a switch. In fast mode, we simply take
+          // over the state of the first predecessor that we have seen.
+          RpoNumber chosen_predecessor = RpoNumber::Invalid();
+          if (data()->is_fast_mode()) {
+            for (RpoNumber pred : current_block->predecessors()) {
+              if (ConsiderBlockForControlFlow(current_block, pred)) {
+                chosen_predecessor = pred;
+                break;
+              }
+            }
+          }
+          if (chosen_predecessor.IsValid()) {
+            no_change_required =
+                pick_state_from(chosen_predecessor, to_be_live);
+          } else {
+            ComputeStateFromManyPredecessors(current_block, to_be_live);
+          }
         }
 
         if (!no_change_required) {
@@ -4461,6 +4487,8 @@ bool LinearScanAllocator::TryReuseSpillForPhi(TopLevelLiveRange* range) {
   DCHECK(!range->HasSpillOperand());
   // Check how many operands belong to the same bundle as the output.
   LiveRangeBundle* out_bundle = range->get_bundle();
+  // No bundles are built in fast mode.
+  if (out_bundle == nullptr) return false;
   RegisterAllocationData::PhiMapValue* phi_map_value =
       data()->GetPhiMapValueFor(range);
   const PhiInstruction* phi = phi_map_value->phi();
@@ -4573,6 +4601,169 @@ void LinearScanAllocator::SpillBetweenUntil(LiveRange* range,
   }
 }
 
+LocalRegisterAllocator::LocalRegisterAllocator(RegisterAllocationData* data,
+                                               RegisterKind kind,
+                                               Zone* local_zone)
+    : RegisterAllocator(data, kind),
+      pieces_(local_zone),
+      fixed_intervals_(num_registers(), ZoneVector<UseInterval>(local_zone),
+                       local_zone),
+      fixed_cursors_(num_registers(), 0, local_zone),
+      busy_until_(num_registers(), LifetimePosition::GapFromInstructionIndex(0),
+                  local_zone),
+      last_register_(data->live_ranges().size(), kUnassignedRegister,
+                     local_zone) {
+  // Floating point registers would need to take aliasing into account.
+  DCHECK_EQ(RegisterKind::kGeneral, kind);
+}
+
+void LocalRegisterAllocator::AllocateRegisters() {
+  const size_t live_ranges_size = data()->live_ranges().size();
+  for (TopLevelLiveRange* range : data()->live_ranges()) {
+    CHECK_EQ(live_ranges_size,
+             data()->live_ranges().size());  // TODO(neis): crbug.com/831822
+    if (!CanProcessRange(range)) continue;
+    data()->tick_counter()->TickAndMaybeEnterSafepoint();
+    SplitAroundRegisterUses(range);
+  }
+
+  // Pieces only overlap if they are needed by the same instruction, so
+  // assigning them in order of their start never has to evict anything.
+  std::sort(pieces_.begin(), pieces_.end(),
+            [](const LiveRange* a, const LiveRange* b) {
+              return a->ShouldBeAllocatedBefore(b);
+            });
+  CollectFixedIntervals();
+  for (LiveRange* piece : pieces_) {
+    data()->tick_counter()->TickAndMaybeEnterSafepoint();
+    AssignRegister(piece);
+  }
+}
+
+void LocalRegisterAllocator::SplitAroundRegisterUses(TopLevelLiveRange* range) {
+  LiveRange* current = range;
+  while (current != nullptr) {
+    if (current->spilled()) {
+      current = current->next();
+      continue;
+    }
+    UsePosition* use = current->NextRegisterPosition(current->Start());
+    if (use == nullptr) {
+      Spill(current, SpillMode::kSpillAtDefinition);
+      current = current->next();
+      continue;
+    }
+    int index = use->pos().ToInstructionIndex();
+    LifetimePosition piece_start =
+        GetSplitPositionForInstruction(current, index);
+    if (piece_start.IsValid()) {
+      LiveRange* piece = SplitRangeAt(current, piece_start);
+      Spill(current, SpillMode::kSpillAtDefinition);
+      current = piece;
+    }
+    LifetimePosition piece_end = PieceEnd(current, index);
+    if (current->Start() < piece_end && piece_end < current->End()) {
+      SplitRangeAt(current, piece_end);
+    }
+    TRACE("Piece %d:%d [%d, %d) for instruction %d\n", range->vreg(),
+          current->relative_id(), current->Start().value(),
+          current->End().value(), index);
+    pieces_.push_back(current);
+    current = current->next();
+  }
+}
+
+LifetimePosition LocalRegisterAllocator::PieceEnd(const LiveRange* range,
+                                                  int instruction_index) {
+  // Uses at the start of an instruction can share their register with the
+  // outputs of the instruction, as long as no moves have to be inserted after
+  // it, i.e. it is not the last instruction of its block.
+  const bool is_block_end = code()
+                                ->GetInstructionBlock(instruction_index)
+                                ->last_instruction_index() == instruction_index;
+  const LifetimePosition next_gap =
+      LifetimePosition::GapFromInstructionIndex(instruction_index + 1);
+  LifetimePosition end = LifetimePosition::Invalid();
+  for (UsePosition* use : range->positions()) {
+    LifetimePosition pos = use->pos();
+    if (pos.ToInstructionIndex() < instruction_index) continue;
+    if (pos.ToInstructionIndex() > instruction_index) break;
+    if (pos.IsInstructionPosition() && (pos.IsEnd() || is_block_end)) {
+      return next_gap;
+    }
+    LifetimePosition use_end =
+        pos.IsGapPosition() ? pos.NextStart() : pos.End();
+    if (!end.IsValid() || end < use_end) end = use_end;
+  }
+  DCHECK(end.IsValid());
+  return end;
+}
+
+void LocalRegisterAllocator::CollectFixedIntervals() {
+  // Both the regular and the deferred fixed ranges block their register, which
+  // is conservative but only affects the instructions that use them.
+  for (TopLevelLiveRange* fixed : GetFixedRegisters()) {
+    if (fixed == nullptr) continue;
+    ZoneVector<UseInterval>& intervals =
+        fixed_intervals_[fixed->assigned_register()];
+    for (UseInterval interval : fixed->intervals()) {
+      intervals.push_back(interval);
+    }
+  }
+  for (ZoneVector<UseInterval>& intervals : fixed_intervals_) {
+    std::sort(intervals.begin(), intervals.end(),
+              [](const UseInterval& a, const UseInterval& b) {
+                return a.start() < b.start();
+              });
+  }
+}
+
+bool LocalRegisterAllocator::IsFree(int reg, const LiveRange* piece) {
+  if (busy_until_[reg] > piece->Start()) return false;
+  // Pieces are processed in order of their start, so fixed intervals that end
+  // before the current piece can be skipped for good.
+  const ZoneVector<UseInterval>& intervals = fixed_intervals_[reg];
+  size_t& cursor = fixed_cursors_[reg];
+  while (cursor < intervals.size() &&
+         intervals[cursor].end() <= piece->Start()) {
+    cursor++;
+  }
+  return cursor == intervals.size() ||
+         intervals[cursor].start() >= piece->End();
+}
+
+void LocalRegisterAllocator::AssignRegister(LiveRange* piece) {
+  const int vreg = piece->TopLevel()->vreg();
+  int reg = last_register_[vreg];
+  if (reg == kUnassignedRegister || !IsFree(reg, piece)) {
+    if (!piece->RegisterFromFirstHint(&reg) ||
+        !data()->config()->IsAllocatableGeneralCode(reg) ||
+        !IsFree(reg, piece)) {
+      reg = kUnassignedRegister;
+      for (int i = 0; i < num_allocatable_registers(); ++i) {
+        int code = allocatable_register_codes()[i];
+        if (IsFree(code, piece)) {
+          reg = code;
+          break;
+        }
+      }
+    }
+  }
+  // Everything else is spilled, so only the constraints of a single
+  // instruction have to be met here, which instruction selection guarantees.
+  CHECK_NE(reg, kUnassignedRegister);
+  TRACE("Assigning %s to live range %d:%d\n", RegisterName(reg), vreg,
+        piece->relative_id());
+  data()->MarkAllocated(piece->representation(), reg);
+  piece->set_assigned_register(reg);
+  piece->SetUseHints(reg);
+  if (piece->IsTopLevel() && piece->TopLevel()->is_phi()) {
+    data()->GetPhiMapValueFor(piece->TopLevel())->set_assigned_register(reg);
+  }
+  busy_until_[reg] = piece->End();
+  last_register_[vreg] = reg;
+}
+
 OperandAssigner::OperandAssigner(RegisterAllocationData* data) : data_(data) {}
 
 void OperandAssigner::DecideSpillingMode() {
@@ -336,6 +336,16 @@ class RegisterAllocationData final : public ZoneObject {
 
   TickCounter* tick_counter() { return tick_counter_; }
 
+  // In fast mode, which is used for functions with a very large number of
+  // virtual registers (see --turbo-fast-register-allocation-threshold), the
+  // general registers are allocated by the LocalRegisterAllocator, and the
+  // linear scan for the remaining register kinds skips heuristics that improve
+  // the quality of the allocation but don't scale well: live range bundles,
+  // loop-aware split positions, and the use-count based merging of
+  // predecessor states at control flow merges.
+  bool is_fast_mode() const { return is_fast_mode_; }
+  static bool UseFastMode(const InstructionSequence* code);
+
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*>& slot_for_const_range() {
     return slot_for_const_range_;
   }
@@ -366,6 +376,7 @@ class RegisterAllocationData final : public ZoneObject {
   ZoneVector<ZoneVector<LiveRange*>> spill_state_;
   TickCounter* const tick_counter_;
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*> slot_for_const_range_;
+  const bool is_fast_mode_;
 };
 
 // Representation of the non-empty interval [start,end[.
@@ -1692,6 +1703,45 @@ class LinearScanAllocator final : public RegisterAllocator {
 #endif
 };
 
+// A simple allocator for the general registers of functions that are
+// allocated in fast mode (see RegisterAllocationData::is_fast_mode). Values
+// live in their spill slot, and only get a register for the instructions that
+// require one: each live range is split around the instructions with register
+// uses, and the resulting short pieces are assigned registers in a single pass
+// without any eviction. This is linear in the number of use positions, but
+// moves a lot more values from and to the stack than the linear scan.
+class LocalRegisterAllocator final : public RegisterAllocator {
+ public:
+  LocalRegisterAllocator(RegisterAllocationData* data, RegisterKind kind,
+                         Zone* local_zone);
+  LocalRegisterAllocator(const LocalRegisterAllocator&) = delete;
+  LocalRegisterAllocator& operator=(const LocalRegisterAllocator&) = delete;
+
+  // Phase 4: compute register assignments.
+  void AllocateRegisters();
+
+ private:
+  // Splits {range} into pieces that each cover the register uses of one
+  // instruction, and spills everything in between.
+  void SplitAroundRegisterUses(TopLevelLiveRange* range);
+  // Returns the end of the piece of {range} that holds the uses of the
+  // instruction at {instruction_index}.
+  LifetimePosition PieceEnd(const LiveRange* range, int instruction_index);
+  void CollectFixedIntervals();
+  bool IsFree(int reg, const LiveRange* piece);
+  void AssignRegister(LiveRange* piece);
+
+  ZoneVector<LiveRange*> pieces_;
+  // For each register code, the intervals of its fixed live ranges sorted by
+  // start, and the first interval that might still overlap the next piece.
+  ZoneVector<ZoneVector<UseInterval>> fixed_intervals_;
+  ZoneVector<size_t> fixed_cursors_;
+  // For each register code, the end of the last piece that was assigned it.
+  ZoneVector<LifetimePosition> busy_until_;
+  // For each virtual register, the register of its previous piece.
+  ZoneVector<int> last_register_;
+};
+
 class OperandAssigner final : public ZoneObject {
  public:
   explicit OperandAssigner(RegisterAllocationData* data);
@@ -4275,7 +4275,11 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
+  if (data->register_allocation_data()->is_fast_mode()) {
+    Run<AllocateGeneralRegistersPhase<LocalRegisterAllocator>>();
+  } else {
+    Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
+  }
 
   if (data->sequence()->HasFPVirtualRegisters()) {
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
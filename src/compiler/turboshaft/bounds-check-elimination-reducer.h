@@ -0,0 +1,271 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include <optional>
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// BoundsCheckEliminationReducer removes bounds checks of the form
+//
+//     DeoptimizeIfNot(UintLessThan(index, length))
+//
+// when {index} is the induction variable of a loop and the check is dominated
+// by the loop condition `index < length`. This is typically the case for
+// loops such as
+//
+//     for (let i = 0; i < a.length; i++) { ... a[i] ... }
+//
+// The analysis is purely local to the input graph and works in two steps:
+//
+//  1. Upper bound: we walk up the dominator tree from the block containing
+//     the check until we reach the loop header, looking for a Branch whose
+//     taken edge implies `index < length` (either with an unsigned comparison,
+//     or with a signed comparison `index <s length` or `!(length <=s index)`).
+//
+//  2. Lower bound: for signed comparisons, we additionally need `index >= 0`.
+//     This holds if {index} is a loop phi whose forward input is a
+//     non-negative constant and whose backedge input is `index + 1` computed
+//     in a block where step 1 already proved `index <s limit` (so that the
+//     increment cannot overflow), or an overflow-checked `index + c` with
+//     `c >= 0`.
+//
+// Sign- and zero-extensions from Word32 to Word64 are looked through on both
+// sides of the check, since the index and length of typed array accesses are
+// often widened to WordPtr after the loop condition has been computed on
+// Word32 values.
+//
+// This reducer only removes checks; it does not (yet) hoist checks whose
+// range depends on a loop bound that is not the length itself.
+template <class Next>
+class BoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(BoundsCheckElimination)
+
+  V<None> REDUCE_INPUT_GRAPH(DeoptimizeIf)(V<None> ig_index,
+                                           const DeoptimizeIfOp& deopt) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphDeoptimizeIf(ig_index, deopt);
+    }
+    if (!v8_flags.turboshaft_bounds_check_elimination) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+
+    // Bounds checks deoptimize when `index < length` does *not* hold.
+    if (!deopt.negated) goto no_change;
+    const ComparisonOp* check =
+        matcher_.TryCast<ComparisonOp>(deopt.condition());
+    if (!check || check->kind != ComparisonOp::Kind::kUnsignedLessThan) {
+      goto no_change;
+    }
+
+    if (!IsInBounds(check->left(), check->right(), __ current_input_block())) {
+      goto no_change;
+    }
+
+    // The check always succeeds, and can thus be removed.
+    return V<None>::Invalid();
+  }
+
+ private:
+  // Looks through Word32 -> Word64 sign/zero extensions.
+  OpIndex SkipExtensions(OpIndex idx) const {
+    while (const ChangeOp* change = matcher_.TryCast<ChangeOp>(idx)) {
+      if (change->from != RegisterRepresentation::Word32() ||
+          change->to != RegisterRepresentation::Word64()) {
+        break;
+      }
+      if (change->kind != ChangeOp::Kind::kSignExtend &&
+          change->kind != ChangeOp::Kind::kZeroExtend) {
+        break;
+      }
+      idx = change->input();
+    }
+    return idx;
+  }
+
+  // Returns true if `index < length` (unsigned) is known to hold in {block}.
+  bool IsInBounds(OpIndex index, OpIndex length, const Block* block) {
+    const bool index_extended = SkipExtensions(index) != index;
+    const bool length_extended = SkipExtensions(length) != length;
+    index = SkipExtensions(index);
+    length = SkipExtensions(length);
+
+    std::optional<bool> is_signed = FindDominatingUpperBound(
+        index, length, block, LoopHeaderOf(index));
+    if (!is_signed.has_value()) return false;
+    if (!*is_signed) {
+      // An unsigned branch condition is only used when it compares exactly
+      // the same values as the check (mixing sign- and zero-extensions does
+      // not preserve unsigned ordering).
+      return !index_extended && !length_extended;
+    }
+    // `index <s length` implies `index <u length` if `index >= 0`. This
+    // remains true regardless of how either side was widened: {index} has the
+    // same value under every interpretation, and the unsigned interpretation
+    // of {length} used by the check is never smaller than the one used by the
+    // branch.
+    return IsNonNegativeInductionVariable(index);
+  }
+
+  // Returns the loop header whose phi defines {index}, or nullptr if {index}
+  // is not a loop phi.
+  const Block* LoopHeaderOf(OpIndex index) const {
+    const PhiOp* phi = matcher_.TryCast<PhiOp>(index);
+    if (!phi || phi->input_count != 2) return nullptr;
+    const Block* block = &__ input_graph().Get(__ input_graph().BlockOf(index));
+    return block->IsLoop() ? block : nullptr;
+  }
+
+  // Walks up the dominator tree from {block} (stopping at {loop_header}) and
+  // looks for a branch implying `index < length`. Returns whether this
+  // comparison is signed, or an empty optional if no such branch was found.
+  std::optional<bool> FindDominatingUpperBound(OpIndex index, OpIndex length,
+                                               const Block* block,
+                                               const Block* loop_header) const {
+    if (loop_header == nullptr) return std::nullopt;
+    for (const Block* current = block; current != nullptr;
+         current = current->GetDominator()) {
+      if (current == loop_header) break;
+      if (current->PredecessorCount() != 1) continue;
+      const Block* pred = current->LastPredecessor();
+      const BranchOp* branch =
+          pred->LastOperation(__ input_graph()).TryCast<BranchOp>();
+      if (!branch || branch->if_true == branch->if_false) continue;
+      const bool taken = branch->if_true == current;
+      const ComparisonOp* cmp =
+          matcher_.TryCast<ComparisonOp>(branch->condition());
+      if (!cmp) continue;
+
+      OpIndex left = SkipExtensions(cmp->left());
+      OpIndex right = SkipExtensions(cmp->right());
+      const bool extended = left != cmp->left() || right != cmp->right();
+      switch (cmp->kind) {
+        case ComparisonOp::Kind::kSignedLessThan:
+          // `index <s length` on the true edge.
+          if (taken && left == index && right == length) return true;
+          break;
+        case ComparisonOp::Kind::kSignedLessThanOrEqual:
+          // `!(length <=s index)` on the false edge.
+          if (!taken && left == length && right == index) return true;
+          break;
+        case ComparisonOp::Kind::kUnsignedLessThan:
+          if (!extended && taken && left == index && right == length) {
+            return false;
+          }
+          break;
+        case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+          if (!extended && !taken && left == length && right == index) {
+            return false;
+          }
+          break;
+        case ComparisonOp::Kind::kEqual:
+          break;
+      }
+    }
+    return std::nullopt;
+  }
+
+  // Returns true if {index} is a loop phi that starts at a non-negative
+  // constant and is only ever incremented without overflowing.
+  bool IsNonNegativeInductionVariable(OpIndex index) const {
+    const Block* loop_header = LoopHeaderOf(index);
+    if (loop_header == nullptr) return false;
+    const PhiOp& phi = matcher_.Cast<PhiOp>(index);
+    if (phi.rep != RegisterRepresentation::Word32()) return false;
+
+    int32_t initial;
+    if (!matcher_.MatchIntegralWord32Constant(phi.input(0), &initial) ||
+        initial < 0) {
+      return false;
+    }
+
+    OpIndex backedge = phi.input(PhiOp::kLoopPhiBackEdgeIndex);
+
+    // Overflow-checked additions deoptimize rather than wrap around, so
+    // adding a non-negative constant keeps {index} non-negative.
+    if (const ProjectionOp* projection =
+            matcher_.TryCast<ProjectionOp>(backedge)) {
+      if (projection->index != OverflowCheckedBinopOp::kValueIndex) {
+        return false;
+      }
+      const OverflowCheckedBinopOp* add =
+          matcher_.TryCast<OverflowCheckedBinopOp>(projection->input());
+      if (!add || add->kind != OverflowCheckedBinopOp::Kind::kSignedAdd ||
+          add->rep != WordRepresentation::Word32()) {
+        return false;
+      }
+      return IsNonNegativeIncrementOf(add->left(), add->right(), index);
+    }
+
+    // Non-checked additions wrap around, so we additionally need the
+    // increment to happen where `index <s limit` holds for some {limit}:
+    // `index + 1 <= limit <= kMaxInt` then cannot overflow.
+    V<Word32> left, right;
+    if (!matcher_.MatchWordAdd(backedge, &left, &right,
+                               WordRepresentation::Word32())) {
+      return false;
+    }
+    if (right == index) std::swap(left, right);
+    if (left != index || !matcher_.MatchIntegralWord32Constant(right, 1u)) {
+      return false;
+    }
+    const Block* increment_block =
+        &__ input_graph().Get(__ input_graph().BlockOf(backedge));
+    return HasDominatingSignedUpperBound(index, increment_block, loop_header);
+  }
+
+  bool IsNonNegativeIncrementOf(OpIndex left, OpIndex right,
+                                OpIndex index) const {
+    if (right == index) std::swap(left, right);
+    int32_t step;
+    return left == index &&
+           matcher_.MatchIntegralWord32Constant(right, &step) && step >= 0;
+  }
+
+  // Returns true if `index <s limit` holds in {block} for any {limit}.
+  bool HasDominatingSignedUpperBound(OpIndex index, const Block* block,
+                                     const Block* loop_header) const {
+    for (const Block* current = block; current != nullptr;
+         current = current->GetDominator()) {
+      if (current == loop_header) break;
+      if (current->PredecessorCount() != 1) continue;
+      const Block* pred = current->LastPredecessor();
+      const BranchOp* branch =
+          pred->LastOperation(__ input_graph()).TryCast<BranchOp>();
+      if (!branch || branch->if_true == branch->if_false) continue;
+      const bool taken = branch->if_true == current;
+      const ComparisonOp* cmp =
+          matcher_.TryCast<ComparisonOp>(branch->condition());
+      if (!cmp || cmp->rep != RegisterRepresentation::Word32()) continue;
+      if (taken && cmp->kind == ComparisonOp::Kind::kSignedLessThan &&
+          cmp->left() == index) {
+        return true;
+      }
+      if (!taken && cmp->kind == ComparisonOp::Kind::kSignedLessThanOrEqual &&
+          cmp->right() == index) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const OperationMatcher matcher_{__ input_graph()};
+};
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "src/base/iterator.h"
 #include "src/builtins/profile-data-reader.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/compiler/backend/instruction-selector-impl.h"
@@ -17,6 +18,7 @@
 #include "src/compiler/turboshaft/phase.h"
 #include "src/compiler/turboshaft/sidetable.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/utils/bit-vector.h"
 
 namespace v8::internal::compiler::turboshaft {
 
@@ -254,13 +256,59 @@ ZoneVector<uint32_t> TurboshaftSpecialRPONumberer::ComputeBlockPermutation(
   return result;
 }
 
+namespace {
+
+// Computes which blocks are never executed according to the feedback that the
+// graph was built from: blocks that end in an unconditional deopt (the graph
+// builders emit those for operations without any feedback, ie operations that
+// were never executed in lower tiers) or in an Unreachable, and blocks all of
+// whose successors are cold. Such blocks can be moved out of the hot path just
+// like blocks that are only reachable through unlikely branches.
+BitVector ComputeColdBlocks(const Graph& graph) {
+  BitVector cold(static_cast<int>(graph.block_count()), graph.graph_zone());
+  // Blocks are in RPO, so except for loop backedges, all successors of a block
+  // come after it. We don't know yet whether a loop header is cold when we see
+  // its backedge, and conservatively treat it as hot.
+  for (const Block& block : base::Reversed(graph.blocks())) {
+    const Operation& terminator = block.LastOperation(graph);
+    if (terminator.Is<DeoptimizeOp>() || terminator.Is<UnreachableOp>()) {
+      cold.Add(block.index().id());
+      continue;
+    }
+    base::SmallVector<Block*, 4> successors = SuccessorBlocks(terminator);
+    if (successors.empty()) continue;
+    bool all_successors_cold = true;
+    for (const Block* successor : successors) {
+      if (successor->index().id() <= block.index().id() ||
+          !cold.Contains(successor->index().id())) {
+        all_successors_cold = false;
+        break;
+      }
+    }
+    if (all_successors_cold) cold.Add(block.index().id());
+  }
+  // The start block is never deferred.
+  cold.Remove(graph.StartBlock().index().id());
+  return cold;
+}
+
+}  // namespace
+
 void PropagateDeferred(Graph& graph) {
+  BitVector cold;
+  if (v8_flags.turboshaft_defer_cold_blocks) cold = ComputeColdBlocks(graph);
+  auto is_cold = [&cold](const Block& block) {
+    return cold.length() > 0 && cold.Contains(block.index().id());
+  };
+
   graph.StartBlock().set_custom_data(
       0, Block::CustomDataKind::kDeferredInSchedule);
   for (Block& block : graph.blocks()) {
     const Block* predecessor = block.LastPredecessor();
     if (predecessor == nullptr) {
       continue;
+    } else if (is_cold(block)) {
+      block.set_custom_data(true, Block::CustomDataKind::kDeferredInSchedule);
     } else if (block.IsLoop()) {
       // We only consider the forward edge for loop headers.
       predecessor = predecessor->NeighboringPredecessor();
@@ -432,7 +432,11 @@ class Pipeline {
                                          data_->register_allocation_data());
     }
 
-    Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
+    if (data_->register_allocation_data()->is_fast_mode()) {
+      Run<AllocateGeneralRegistersPhase<LocalRegisterAllocator>>();
+    } else {
+      Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
+    }
 
     if (data_->sequence()->HasFPVirtualRegisters()) {
       Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
@@ -4202,6 +4202,20 @@ void Shell::WriteIgnitionDispatchCountersFile(v8::Isolate* isolate) {
                    .ToLocalChecked());
 }
 
+void Shell::WriteBytecodeHistogramFile(v8::Isolate* isolate) {
+  HandleScope handle_scope(isolate);
+  Local<Context> context = Context::New(isolate);
+  Context::Scope context_scope(context);
+
+  i::Handle<i::JSObject> histogram = reinterpret_cast<i::Isolate*>(isolate)
+                                         ->interpreter()
+                                         ->GetBytecodeHistogramObject();
+  std::ofstream histogram_stream(i::v8_flags.bytecode_histogram_output_file);
+  histogram_stream << *String::Utf8Value(
+      isolate,
+      JSON::Stringify(context, Utils::ToLocal(histogram)).ToLocalChecked());
+}
+
 namespace {
 int LineFromOffset(Local<debug::Script> script, int offset) {
   debug::Location location = script->GetSourceLocation(offset);
@@ -5662,6 +5676,13 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.wasm_trap_handler = true;
     } else if (FlagMatches("--no-wasm-trap-handler", &argv[i])) {
       options.wasm_trap_handler = false;
+    } else if (FlagWithArgMatches("--wasm-cache-dir", &flag_value, argc, argv,
+                                  &i)) {
+      options.wasm_cache_dir = flag_value;
+    } else if (FlagWithArgMatches("--wasm-cache-max-size", &flag_value, argc,
+                                  argv, &i)) {
+      // Value is expressed in MB.
+      options.wasm_cache_max_size = atoi(flag_value) * i::MB;
 #endif  // V8_ENABLE_WEBASSEMBLY
     } else if (FlagMatches("--expose-fast-api", &argv[i])) {
       options.expose_fast_api = true;
@@ -6425,6 +6446,12 @@ int Shell::Main(int argc, char* argv[]) {
   } else {
     v8::V8::InitializeExternalStartupData(argv[0]);
   }
+#if V8_ENABLE_WEBASSEMBLY
+  if (options.wasm_cache_dir) {
+    v8::WasmModuleCache::SetDirectory(options.wasm_cache_dir,
+                                      options.wasm_cache_max_size);
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
   int result = 0;
   Isolate::CreateParams create_params;
   ShellArrayBufferAllocator shell_array_buffer_allocator;
@@ -6620,6 +6647,10 @@ int Shell::Main(int argc, char* argv[]) {
         WriteIgnitionDispatchCountersFile(isolate);
       }
 
+      if (i::v8_flags.bytecode_histogram_output_file != nullptr) {
+        WriteBytecodeHistogramFile(isolate);
+      }
+
       if (options.cpu_profiler) {
         CpuProfile* profile =
             cpu_profiler->StopProfiling(String::Empty(isolate));
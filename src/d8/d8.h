@@ -510,6 +510,10 @@ class ShellOptions {
   DisallowReassignment<int> repeat_compile = {"repeat-compile", 1};
 #if V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> wasm_trap_handler = {"wasm-trap-handler", true};
+  DisallowReassignment<const char*> wasm_cache_dir = {"wasm-cache-dir",
+                                                      nullptr};
+  DisallowReassignment<size_t> wasm_cache_max_size = {"wasm-cache-max-size",
+                                                      256 * i::MB};
 #endif  // V8_ENABLE_WEBASSEMBLY
   DisallowReassignment<bool> expose_fast_api = {"expose-fast-api", false};
   DisallowReassignment<size_t> max_serializer_memory = {"max-serializer-memory",
@@ -805,6 +809,7 @@ class Shell : public i::AllStatic {
   static std::atomic<bool> valid_fuzz_script_;
 
   static void WriteIgnitionDispatchCountersFile(v8::Isolate* isolate);
+  static void WriteBytecodeHistogramFile(v8::Isolate* isolate);
   // Append LCOV coverage data to file.
   static void WriteLcovData(v8::Isolate* isolate, const char* file);
   static Counter* GetCounter(const char* name, bool is_histogram);
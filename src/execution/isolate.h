@@ -116,6 +116,7 @@ class Bootstrapper;
 class BuiltinsConstantsTableBuilder;
 class CancelableTaskManager;
 class Logger;
+class CodeCacheBundle;
 class CodeTracer;
 class CommonFrame;
 class CompilationCache;
@@ -1509,6 +1510,32 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return snapshot_blob_ != nullptr && snapshot_blob_->raw_size != 0;
   }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  // Whether context snapshots are only decompressed once, see
+  // CreateParams::cache_decompressed_context_snapshots.
+  bool cache_decompressed_context_snapshots() const {
+    return cache_decompressed_context_snapshots_;
+  }
+  void set_cache_decompressed_context_snapshots(bool value) {
+    cache_decompressed_context_snapshots_ = value;
+  }
+  // Decompressed context snapshots, indexed by context snapshot index. Only
+  // populated if cache_decompressed_context_snapshots() is set.
+  std::vector<std::unique_ptr<SnapshotData>>*
+  decompressed_context_snapshot_cache() {
+    return &decompressed_context_snapshot_cache_;
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  // Open code cache bundles, whose pools are looked up by script segments
+  // being deserialized, possibly off-thread.
+  std::vector<CodeCacheBundle*>* code_cache_bundles() {
+    return &code_cache_bundles_;
+  }
+  base::Mutex* code_cache_bundles_mutex() {
+    return &code_cache_bundles_mutex_;
+  }
+
   bool IsDead() const { return has_fatal_error_; }
   void SignalFatalError() { has_fatal_error_ = true; }
 
@@ -2717,6 +2744,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   bool allow_atomics_wait_ = true;
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  bool cache_decompressed_context_snapshots_ = false;
+  std::vector<std::unique_ptr<SnapshotData>>
+      decompressed_context_snapshot_cache_;
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  std::vector<CodeCacheBundle*> code_cache_bundles_;
+  base::Mutex code_cache_bundles_mutex_;
+
   base::Mutex managed_ptr_destructors_mutex_;
   ManagedPtrDestructor* managed_ptr_destructors_head_ = nullptr;
 
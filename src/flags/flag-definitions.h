@@ -594,6 +594,16 @@ DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, min_maglev_inlining_frequency, 0.95)
 DEFINE_BOOL(maglev_reuse_stack_slots, true,
             "reuse stack slots in the maglev optimizing compiler")
+DEFINE_BOOL(maglev_regalloc_spill_costs, false,
+            "pick registers to free in the maglev register allocator based on "
+            "the spill and reload code this causes around loops")
+DEFINE_INT(maglev_regalloc_spill_costs_max_graph_size, 20000,
+           "maximum number of nodes in a maglev graph for which the register "
+           "allocator considers spill costs")
+DEFINE_BOOL(maglev_bounds_check_elimination, false,
+            "remove bounds checks on indices that are known to be in range in "
+            "the maglev optimizing compiler")
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_bounds_check_elimination)
 DEFINE_BOOL(maglev_untagged_phis, true,
             "enable phi untagging in the maglev optimizing compiler")
 DEFINE_BOOL(maglev_hoist_osr_value_phi_untagging, true,
@@ -953,6 +963,9 @@ DEFINE_STRING(
     trace_ignition_dispatches_output_file, nullptr,
     "write the bytecode handler dispatch table to the specified file (d8 only) "
     "(requires building with v8_enable_ignition_dispatch_counting)")
+DEFINE_STRING(bytecode_histogram_output_file, nullptr,
+              "write a histogram of the bytecodes and bytecode pairs of all "
+              "live functions to the specified file on exit (d8 only)")
 
 DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
@@ -1007,6 +1020,11 @@ DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "--short-builtin-calls are also enabled")
 DEFINE_INT(baseline_batch_compilation_threshold, 4 * KB,
            "the estimated instruction size of a batch to trigger compilation")
+DEFINE_BOOL(sparkplug_share_code, false,
+            "share Sparkplug code between the isolates of an isolate group")
+DEFINE_SIZE_T(sparkplug_shared_code_cache_max_size, 16 * MB,
+              "maximum size in bytes of the Sparkplug code shared between "
+              "isolates")
 DEFINE_BOOL(trace_baseline, false, "trace baseline compilation")
 DEFINE_BOOL(trace_baseline_batch_compilation, false,
             "trace baseline batch compilation")
@@ -1304,6 +1322,9 @@ DEFINE_STRING(
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
+DEFINE_INT(turbo_fast_register_allocation_threshold, 50000,
+           "use a faster, lower quality register allocation for functions "
+           "with at least this many virtual registers (0 means never)")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
@@ -1404,12 +1425,18 @@ DEFINE_IMPLICATION(turboshaft_wasm_in_js_inlining, turbo_inline_js_wasm_calls)
 
 DEFINE_BOOL(turboshaft_instruction_selection, true,
             "run instruction selection on Turboshaft IR directly")
+DEFINE_BOOL(turboshaft_defer_cold_blocks, false,
+            "move blocks that never executed according to feedback (eg, soft "
+            "deopts) out of line, like blocks behind unlikely branches")
 
 DEFINE_BOOL(turboshaft_load_elimination, true,
             "enable Turboshaft's low-level load elimination for JS")
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_bounds_check_elimination, false,
+            "enable Turboshaft's removal of bounds checks on loop induction "
+            "variables")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1446,6 +1473,8 @@ DEFINE_WEAK_IMPLICATION(turboshaft_future,
 #endif
 DEFINE_WEAK_IMPLICATION(turboshaft_future,
                         turboshaft_wasm_instruction_selection_staged)
+DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_bounds_check_elimination)
+DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_defer_cold_blocks)
 
 #if V8_ENABLE_WEBASSEMBLY
 // Shared-everything is implemented on turboshaft only for now.
@@ -1489,6 +1518,10 @@ DEFINE_BOOL_READONLY(turboshaft_trace_intermediate_reductions, false,
 DEFINE_BOOL(profile_guided_optimization, true, "profile guided optimization")
 DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
+DEFINE_BOOL(code_cache_keep_tiering_decisions, false,
+            "keep the tiering decisions of functions that were optimized when "
+            "a code cache was produced, so that they are optimized early "
+            "after the cache is consumed")
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
 DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
@@ -2142,6 +2175,13 @@ DEFINE_BOOL(flush_code_based_on_time, false,
 DEFINE_BOOL(flush_code_based_on_tab_visibility, false,
             "Flush code when tab goes into the background.")
 DEFINE_INT(bytecode_old_time, 30, "number of seconds before we flush code")
+DEFINE_BOOL(flush_code_adaptively, false,
+            "scale the age at which bytecode and baseline code are flushed by "
+            "the estimated savings and recompile cost of each function and by "
+            "memory pressure")
+DEFINE_IMPLICATION(flush_code_adaptively, flush_baseline_code)
+DEFINE_NEG_IMPLICATION(flush_code_adaptively,
+                       flush_code_based_on_tab_visibility)
 DEFINE_BOOL(stress_flush_code, false, "stress code flushing")
 DEFINE_BOOL(trace_flush_code, false, "trace bytecode flushing")
 DEFINE_BOOL(use_marking_progress_bar, true,
@@ -2419,6 +2459,13 @@ DEFINE_BOOL(external_reference_stats, false,
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
 
+// shared-script-cache.cc
+DEFINE_BOOL(isolate_group_script_cache, false,
+            "share compiled scripts between the isolates of an isolate group")
+DEFINE_SIZE_T(isolate_group_script_cache_max_size, 32 * MB,
+              "maximum size in bytes of the compiled scripts shared between "
+              "isolates")
+
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // lazy-compile-dispatcher.cc
@@ -2437,6 +2484,15 @@ DEFINE_EXPERIMENTAL_FEATURE(
     parallel_compile_tasks_for_lazy,
     "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_EXPERIMENTAL_FEATURE(
+    parallel_preparse,
+    "preparse lazy top-level functions of classic scripts on worker threads")
+DEFINE_UINT(parallel_preparse_max_threads, 0,
+            "maximum number of threads used for parallel preparsing "
+            "(0 means no limit)")
+DEFINE_BOOL(stress_parallel_preparse_yield, false,
+            "make the skimmer for parallel preparsing yield after every token "
+            "(for testing)")
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -2672,6 +2728,17 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "default in debug builds and once per process for Android.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
+DEFINE_UINT(code_cache_chunk_size, 0,
+            "Split code caches into chunks holding the compiled data of "
+            "functions with about this many bytes of bytecode, which are "
+            "deserialized in parallel. 0 disables splitting.")
+DEFINE_BOOL(stress_code_cache_chunk_workers, false,
+            "deserialize all code cache chunks on worker threads, without the "
+            "help of the joining thread (for testing)")
+DEFINE_BOOL(map_read_only_snapshot, true,
+            "Map the read-only space copy-on-write from the snapshot file "
+            "instead of copying it, if the snapshot layout allows (Linux "
+            "only).")
 DEFINE_BOOL(trace_deserialization, false, "Trace the snapshot deserialization.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
@@ -2847,6 +2914,23 @@ DEFINE_STRING(startup_src, nullptr,
               "Write V8 startup as C++ src. (mksnapshot only)")
 DEFINE_STRING(startup_blob, nullptr,
               "Write V8 startup blob file. (mksnapshot only)")
+DEFINE_BOOL(mappable_read_only_snapshot, false,
+            "Lay out the read-only snapshot such that it can be mapped "
+            "copy-on-write from the snapshot file. (mksnapshot only, static "
+            "roots only)")
+DEFINE_STRING(snapshot_compression_codec, "zlib",
+              "Codec for compressing the snapshot (none, zlib) in builds with "
+              "snapshot compression. (mksnapshot only)")
+DEFINE_UINT(snapshot_compression_chunk_size, 256 * KB,
+            "Size of the independently compressed snapshot chunks, which are "
+            "decompressed in parallel. (mksnapshot only)")
+DEFINE_BOOL(snapshot_compression_statistics, false,
+            "Print the compression ratio and time of every snapshot "
+            "compression codec. (mksnapshot only)")
+DEFINE_STRING(lazy_context_snapshot_properties, "",
+              "Comma-separated list of global object properties which are "
+              "only deserialized from a context snapshot when they are first "
+              "accessed. (snapshot creation only)")
 DEFINE_STRING(target_arch, nullptr,
               "The mksnapshot target arch. (mksnapshot only)")
 DEFINE_STRING(target_os, nullptr, "The mksnapshot target os. (mksnapshot only)")
@@ -3061,6 +3145,8 @@ DEFINE_IMPLICATION(log_code_disassemble, log_code)
 DEFINE_BOOL(log_function_events, false,
             "Log function events "
             "(parse, compile, execute) separately.")
+// Workers preparsing in parallel have no logger to report their events to.
+DEFINE_NEG_IMPLICATION(log_function_events, parallel_preparse)
 
 DEFINE_BOOL(detailed_line_info, false,
             "Always generate detailed line information for CPU profiling.")
@@ -3233,6 +3319,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3267,6 +3354,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_preparse)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -468,6 +468,9 @@ uint32_t ComputeFlagListHash() {
     // We want to be able to flip --profile-deserialization without
     // causing the code cache to get invalidated by this hash.
     if (flag.PointsTo(&v8_flags.profile_deserialization)) continue;
+    // Consumers understand code caches with and without chunks.
+    if (flag.PointsTo(&v8_flags.code_cache_chunk_size)) continue;
+    if (flag.PointsTo(&v8_flags.stress_code_cache_chunk_workers)) continue;
     // Skip v8_flags.random_seed and v8_flags.predictable to allow predictable
     // code caching.
     if (flag.PointsTo(&v8_flags.random_seed)) continue;
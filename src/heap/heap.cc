@@ -4239,6 +4239,20 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
   }
 }
 
+void Heap::SetCodeFlushingRecompileCost(double cost) {
+  DCHECK_GT(cost, 0);
+  code_flushing_recompile_cost_.store(cost, std::memory_order_relaxed);
+}
+
+double Heap::CodeFlushingAgeScale() const {
+  // Memory pressure notifications have already been turned into GCs that
+  // reduce memory by the time marking starts, so these stand in for them.
+  static constexpr double kReduceMemoryScale = 0.25;
+  double scale = code_flushing_recompile_cost_.load(std::memory_order_relaxed);
+  if (ShouldReduceMemory()) scale *= kReduceMemoryScale;
+  return scale;
+}
+
 void Heap::EagerlyFreeExternalMemoryAndWasmCode() {
 #if V8_ENABLE_WEBASSEMBLY
   if (v8_flags.flush_liftoff_code) {
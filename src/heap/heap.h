@@ -666,6 +666,14 @@ class Heap final {
            v8::MemoryPressureLevel::kNone;
   }
 
+  // Sets the embedder's estimate of the cost of recompiling flushed functions,
+  // relative to the default of 1.0. Only used with --flush-code-adaptively.
+  V8_EXPORT_PRIVATE void SetCodeFlushingRecompileCost(double cost);
+
+  // Returns the factor by which --flush-code-adaptively scales the age at
+  // which code is flushed in the current GC cycle.
+  double CodeFlushingAgeScale() const;
+
   bool CollectionRequested();
 
   void CheckCollectionRequested();
@@ -2127,6 +2135,9 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Set by the embedder, see SetCodeFlushingRecompileCost().
+  std::atomic<double> code_flushing_recompile_cost_{1.0};
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
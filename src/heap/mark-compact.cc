@@ -75,6 +75,7 @@
 #include "src/heap/weak-object-worklists.h"
 #include "src/heap/zapping.h"
 #include "src/init/v8.h"
+#include "src/logging/counters.h"
 #include "src/logging/tracing-flags.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/foreign.h"
@@ -3321,6 +3322,10 @@ void MarkCompactCollector::FlushBytecodeFromSFI(
   Tagged<BytecodeArray> bytecode_array =
       shared_info->GetBytecodeArray(heap_->isolate());
 
+  Counters* counters = heap_->isolate()->counters();
+  counters->flushed_bytecode()->Increment();
+  counters->flushed_bytecode_size()->Increment(bytecode_array->Size());
+
 #ifdef V8_ENABLE_SANDBOX
   DCHECK(!HeapLayout::InWritableSharedSpace(shared_info));
   // Zap the old entry in the trusted pointer table.
@@ -3498,12 +3503,15 @@ bool MarkCompactCollector::ProcessOldBaselineSFI(
     // the owning JSFunction.
     DCHECK(MarkingHelper::IsMarkedOrAlwaysLive(heap_, non_atomic_marking_state_,
                                                baseline_code));
-  } else if (is_bytecode_live || bytecode_already_decompiled) {
-    // Reset the function_data field to the BytecodeArray, InterpreterData,
-    // or UncompiledData found on the baseline code. We can skip this step
-    // if the BytecodeArray is not live and not already decompiled, because
-    // FlushBytecodeFromSFI below will set the function_data field.
-    flushing_candidate->FlushBaselineCode();
+  } else {
+    heap_->isolate()->counters()->flushed_baseline_code()->Increment();
+    if (is_bytecode_live || bytecode_already_decompiled) {
+      // Reset the function_data field to the BytecodeArray, InterpreterData,
+      // or UncompiledData found on the baseline code. We can skip this step
+      // if the BytecodeArray is not live and not already decompiled, because
+      // FlushBytecodeFromSFI below will set the function_data field.
+      flushing_candidate->FlushBaselineCode();
+    }
   }
 
   if (!is_bytecode_live) {
@@ -3528,6 +3536,7 @@ void MarkCompactCollector::FlushSFI(Tagged<SharedFunctionInfo> sfi,
     // with an uncompiled data object.
     FlushBytecodeFromSFI(sfi);
   }
+  sfi->set_bytecode_was_flushed(true);
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_MARKING_VISITOR_INL_H_
 #define V8_HEAP_MARKING_VISITOR_INL_H_
 
+#include <algorithm>
+
 #include "src/common/globals.h"
 #include "src/heap/ephemeron-remembered-set.h"
 #include "src/heap/heap-layout-inl.h"
@@ -453,7 +455,11 @@ bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushCode(
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     Tagged<SharedFunctionInfo> sfi) const {
-  if (v8_flags.flush_code_based_on_time) {
+  if (v8_flags.flush_code_adaptively) {
+    return sfi->age() >= AdaptiveOldAge(sfi, v8_flags.flush_code_based_on_time
+                                                 ? v8_flags.bytecode_old_time
+                                                 : v8_flags.bytecode_old_age);
+  } else if (v8_flags.flush_code_based_on_time) {
     return sfi->age() >= v8_flags.bytecode_old_time;
   } else if (v8_flags.flush_code_based_on_tab_visibility) {
     return isolate_in_background_ ||
@@ -463,6 +469,38 @@ bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
   }
 }
 
+template <typename ConcreteVisitor>
+uint16_t MarkingVisitorBase<ConcreteVisitor>::AdaptiveOldAge(
+    Tagged<SharedFunctionInfo> sfi, int old_age) const {
+  // Functions that were executed since the last GC are never flushed.
+  static constexpr double kMinOldAge = 2;
+  static constexpr double kMaxOldAge = SharedFunctionInfo::kMaxAge - 1;
+
+  // Estimate the memory that flushing would free and the cost of recompiling
+  // the function, which is roughly proportional to the length of its
+  // bytecode. Functions that free more memory per unit of recompile cost
+  // (e.g. those with baseline code) get a lower age threshold, so they are
+  // flushed after fewer GCs without being executed. Costly ones get a higher
+  // threshold.
+  Tagged<Object> data = sfi->GetTrustedData(heap_->isolate());
+  size_t savings = 0;
+  if (IsCode(data)) {
+    Tagged<Code> baseline_code = Cast<Code>(data);
+    savings += baseline_code->instruction_size();
+    data = baseline_code->bytecode_or_interpreter_data();
+  }
+  if (!IsBytecodeArray(data)) return old_age;
+  Tagged<BytecodeArray> bytecode = Cast<BytecodeArray>(data);
+  size_t cost = std::max(bytecode->length(), 1);
+  savings += bytecode->Size() +
+             bytecode->constant_pool()->length() * kTaggedSize;
+
+  // A function with only bytecode and a small constant pool saves about twice
+  // its bytecode length and keeps the non-adaptive threshold.
+  double age = old_age * code_flushing_age_scale_ * 2 * cost / savings;
+  return static_cast<uint16_t>(std::clamp(age, kMinOldAge, kMaxOldAge));
+}
+
 template <typename ConcreteVisitor>
 void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
     Tagged<SharedFunctionInfo> sfi) const {
@@ -488,11 +526,15 @@ void MarkingVisitorBase<ConcreteVisitor>::MakeOlder(
   } else if (v8_flags.flush_code_based_on_tab_visibility) {
     // No need to increment age.
   } else {
+    // The adaptive policy may pick a larger threshold than the default one.
+    const uint16_t max_age = v8_flags.flush_code_adaptively
+                                 ? SharedFunctionInfo::kMaxAge - 1
+                                 : v8_flags.bytecode_old_age;
     uint16_t age = sfi->age();
-    if (age < v8_flags.bytecode_old_age) {
+    if (age < max_age) {
       sfi->CompareExchangeAge(age, age + 1);
     }
-    DCHECK_LE(sfi->age(), v8_flags.bytecode_old_age);
+    DCHECK_LE(sfi->age(), max_age);
   }
 }
 
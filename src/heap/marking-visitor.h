@@ -62,7 +62,10 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
         code_flush_mode_(code_flush_mode),
         should_keep_ages_unchanged_(should_keep_ages_unchanged),
         code_flushing_increase_(code_flushing_increase),
-        isolate_in_background_(heap->isolate()->is_backgrounded())
+        isolate_in_background_(heap->isolate()->is_backgrounded()),
+        code_flushing_age_scale_(v8_flags.flush_code_adaptively
+                                     ? heap->CodeFlushingAgeScale()
+                                     : 1.0)
 #ifdef V8_COMPRESS_POINTERS
         ,
         external_pointer_table_(&heap->isolate()->external_pointer_table()),
@@ -207,6 +210,9 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   bool HasBytecodeArrayForFlushing(Tagged<SharedFunctionInfo> sfi) const;
   bool IsOld(Tagged<SharedFunctionInfo> sfi) const;
   void MakeOlder(Tagged<SharedFunctionInfo> sfi) const;
+  // Returns the age at which the code of {sfi} is flushed with
+  // --flush-code-adaptively, given the non-adaptive threshold {old_age}.
+  uint16_t AdaptiveOldAge(Tagged<SharedFunctionInfo> sfi, int old_age) const;
 
   MarkingWorklists::Local* const local_marking_worklists_;
   WeakObjects::Local* const local_weak_objects_;
@@ -216,6 +222,7 @@ class MarkingVisitorBase : public ConcurrentHeapVisitor<int, ConcreteVisitor> {
   const bool should_keep_ages_unchanged_;
   const uint16_t code_flushing_increase_;
   const bool isolate_in_background_;
+  const double code_flushing_age_scale_;
 #ifdef V8_COMPRESS_POINTERS
   ExternalPointerTable* const external_pointer_table_;
   ExternalPointerTable* const shared_external_pointer_table_;
@@ -0,0 +1,112 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INIT_ISOLATE_GROUP_CACHE_H_
+#define V8_INIT_ISOLATE_GROUP_CACHE_H_
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// The bookkeeping shared by the caches that an IsolateGroup keeps for all of
+// its isolates: a map from {Key} to immutable {Entry}s that is guarded by a
+// mutex and bounded in size, and hit and miss counters.
+//
+// {Key} needs an operator== and a `size_t Hash() const` method. {Entry} needs
+// a `size_t size_in_bytes() const` method, and only has to be complete where
+// Insert is used.
+template <typename Key, typename Entry>
+class IsolateGroupCache {
+ public:
+  IsolateGroupCache(const IsolateGroupCache&) = delete;
+  IsolateGroupCache& operator=(const IsolateGroupCache&) = delete;
+
+  size_t entry_count() const {
+    base::MutexGuard guard(&mutex_);
+    return entries_.size();
+  }
+  size_t size_in_bytes() const { return size_in_bytes_.load(); }
+  size_t hits() const { return hits_.load(); }
+  size_t misses() const { return misses_.load(); }
+
+  bool Contains(const Key& key) const {
+    base::MutexGuard guard(&mutex_);
+    return entries_.count(key) != 0;
+  }
+
+  // Drops all entries, e.g. when the read-only heap of the group goes away.
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    entries_.clear();
+    size_in_bytes_ = 0;
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+ protected:
+  IsolateGroupCache() = default;
+  ~IsolateGroupCache() = default;
+
+  // Returns the entry for {key}, or an empty pointer. Entries are immutable,
+  // so callers should use them after the lookup instead of holding the mutex:
+  // e.g. an allocation could otherwise trigger a GC that waits for a thread
+  // that is blocked on the mutex.
+  std::shared_ptr<const Entry> Find(const Key& key) const {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return {};
+    return it->second;
+  }
+
+  // Adds {entry} for {key}, unless there already is an entry for {key} or
+  // the cache would grow beyond {max_size} bytes.
+  void Insert(const Key& key, std::shared_ptr<const Entry> entry,
+              size_t max_size) {
+    size_t entry_size = entry->size_in_bytes();
+    base::MutexGuard guard(&mutex_);
+    if (!HasRoomFor(entry_size, max_size)) return;
+    if (entries_.emplace(key, std::move(entry)).second) {
+      size_in_bytes_ += entry_size;
+    }
+  }
+
+  // Drops the entry for {key}, if there is one.
+  void Remove(const Key& key) {
+    base::MutexGuard guard(&mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) return;
+    size_in_bytes_ -= it->second->size_in_bytes();
+    entries_.erase(it);
+  }
+
+  // Whether an entry of {size} bytes would still fit into the cache, to avoid
+  // building entries that would be dropped anyway.
+  bool HasRoomFor(size_t size, size_t max_size) const {
+    return size_in_bytes_.load() + size <= max_size;
+  }
+
+  void RecordHit() { hits_++; }
+  void RecordMiss() { misses_++; }
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.Hash(); }
+  };
+
+  mutable base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const Entry>, KeyHash> entries_;
+  std::atomic<size_t> size_in_bytes_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INIT_ISOLATE_GROUP_CACHE_H_
@@ -6,6 +6,8 @@
 
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/platform/memory.h"
+#include "src/baseline/baseline-code-cache.h"
+#include "src/codegen/shared-script-cache.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/code-range.h"
@@ -69,7 +71,9 @@ IsolateGroup* IsolateGroup::GetProcessWideIsolateGroup() {
 }
 #endif  // V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES
 
-IsolateGroup::IsolateGroup() {}
+IsolateGroup::IsolateGroup()
+    : baseline_code_cache_(std::make_unique<baseline::BaselineCodeCache>()),
+      shared_script_cache_(std::make_unique<SharedScriptCache>()) {}
 IsolateGroup::~IsolateGroup() {
   DCHECK_EQ(reference_count_.load(), 0);
   DCHECK_EQ(isolate_count_.load(), 0);
@@ -185,6 +189,10 @@ void IsolateGroup::ClearSharedSpaceIsolate() {
 void IsolateGroup::ClearReadOnlyArtifacts() {
   DCHECK_EQ(0, IsolateCount());
   read_only_artifacts_.reset();
+  // Cached code may refer to objects in the read-only heap that is being torn
+  // down.
+  baseline_code_cache_->Clear();
+  shared_script_cache_->Clear();
 }
 
 ReadOnlyArtifacts* IsolateGroup::InitializeReadOnlyArtifacts() {
@@ -33,6 +33,11 @@ class CodeRange;
 class Isolate;
 class ReadOnlyHeap;
 class ReadOnlyArtifacts;
+class SharedScriptCache;
+
+namespace baseline {
+class BaselineCodeCache;
+}  // namespace baseline
 
 // An IsolateGroup allows an API user to control which isolates get allocated
 // together in a shared pointer cage.
@@ -159,6 +164,18 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
   ReadOnlyArtifacts* InitializeReadOnlyArtifacts();
   void ClearReadOnlyArtifacts();
 
+  // Sparkplug code shared between the isolates of this group, see
+  // --sparkplug-share-code.
+  baseline::BaselineCodeCache* baseline_code_cache() const {
+    return baseline_code_cache_.get();
+  }
+
+  // Compiled scripts shared between the isolates of this group, see
+  // --isolate-group-script-cache.
+  SharedScriptCache* shared_script_cache() const {
+    return shared_script_cache_.get();
+  }
+
 #ifdef V8_ENABLE_SANDBOX
   CodePointerTable* code_pointer_table() { return &code_pointer_table_; }
 #endif  // V8_ENABLE_SANDBOX
@@ -221,6 +238,9 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
   ReadOnlyHeap* shared_read_only_heap_ = nullptr;
   Isolate* shared_space_isolate_ = nullptr;
 
+  std::unique_ptr<baseline::BaselineCodeCache> baseline_code_cache_;
+  std::unique_ptr<SharedScriptCache> shared_script_cache_;
+
 #ifdef V8_ENABLE_SANDBOX
   CodePointerTable code_pointer_table_;
 #endif  // V8_ENABLE_SANDBOX
@@ -24,47 +24,44 @@ namespace internal {
 namespace {
 
 v8::StartupData g_snapshot;
+base::OS::MemoryMappedFile* g_snapshot_file = nullptr;
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
   data->raw_size = 0;
 }
 
-void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
-  ClearStartupData(data);
-}
-
 void FreeStartupData() {
-  DeleteStartupData(&g_snapshot);
+  ClearStartupData(&g_snapshot);
+  delete g_snapshot_file;
+  g_snapshot_file = nullptr;
 }
 
+// The blob is mapped rather than read, so that the read-only space can be
+// mapped copy-on-write from the same file (see --map-read-only-snapshot) and
+// unused parts of the blob are never paged in.
 void Load(const char* blob_file, v8::StartupData* startup_data,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
-  FILE* file = base::Fopen(blob_file, "rb");
+  base::OS::MemoryMappedFile* file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
     return;
   }
-
-  fseek(file, 0, SEEK_END);
-  startup_data->raw_size = static_cast<int>(ftell(file));
-  rewind(file);
-
-  startup_data->data = new char[startup_data->raw_size];
-  int read_size = static_cast<int>(fread(const_cast<char*>(startup_data->data),
-                                         1, startup_data->raw_size, file));
-  base::Fclose(file);
-
-  if (startup_data->raw_size == read_size) {
-    (*setter_fn)(startup_data);
-  } else {
+  if (file->size() == 0 || file->size() > static_cast<size_t>(kMaxInt)) {
     PrintF(stderr, "Corrupted startup resource '%s'.\n", blob_file);
+    delete file;
+    return;
   }
+
+  g_snapshot_file = file;
+  startup_data->data = static_cast<const char*>(file->memory());
+  startup_data->raw_size = static_cast<int>(file->size());
+  (*setter_fn)(startup_data);
 }
 
 void LoadFromFile(const char* snapshot_blob) {
@@ -309,6 +309,33 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
   return false;
 }
 
+// static
+bool Bytecodes::IsJumpLookahead(Bytecode bytecode, OperandScale operand_scale) {
+  if (operand_scale == OperandScale::kSingle) {
+    // Comparisons are almost always followed by a conditional jump on their
+    // result, e.g. TestEqualStrict + JumpIfFalse for an if-statement.
+    switch (bytecode) {
+      case Bytecode::kTestEqual:
+      case Bytecode::kTestEqualStrict:
+      case Bytecode::kTestLessThan:
+      case Bytecode::kTestGreaterThan:
+      case Bytecode::kTestLessThanOrEqual:
+      case Bytecode::kTestGreaterThanOrEqual:
+      case Bytecode::kTestReferenceEqual:
+      case Bytecode::kTestInstanceOf:
+      case Bytecode::kTestIn:
+      case Bytecode::kTestUndetectable:
+      case Bytecode::kTestNull:
+      case Bytecode::kTestUndefined:
+      case Bytecode::kTestTypeOf:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
 // static
 bool Bytecodes::IsBytecodeWithScalableOperands(Bytecode bytecode) {
   for (int i = 0; i < NumberOfOperands(bytecode); i++) {
@@ -1279,6 +1279,56 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpDispatchLookahead(TNode<WordT> target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  GotoIf(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode,
+                   IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &do_inline_jump_if_false, &done);
+
+  BIND(&do_inline_jump_if_true);
+  InlineJumpIfBoolean(Bytecode::kJumpIfTrue);
+
+  BIND(&do_inline_jump_if_false);
+  InlineJumpIfBoolean(Bytecode::kJumpIfFalse);
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineJumpIfBoolean(Bytecode jump_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  // Same as the JumpIfTrue and JumpIfFalse handlers: either jumps to the
+  // target or dispatches to the bytecode following the jump.
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator,
+                    jump_bytecode == Bytecode::kJumpIfTrue
+                        ? TNode<Object>(TrueConstant())
+                        : TNode<Object>(FalseConstant()),
+                    0);
+
+  DCHECK_EQ(implicit_register_use_,
+            Bytecodes::GetImplicitRegisterUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1291,6 +1341,8 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
     TNode<WordT> target_bytecode) {
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsJumpLookahead(bytecode_, operand_scale_)) {
+    JumpDispatchLookahead(target_bytecode);
   }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
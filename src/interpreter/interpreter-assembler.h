@@ -285,7 +285,8 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
+  // instruction, and conditional jump lookahead if it is likely followed by a
+  // JumpIfTrue or JumpIfFalse.
   void DispatchToBytecodeWithOptionalStarLookahead(
       TNode<WordT> target_bytecode);
 
@@ -449,6 +450,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including the subsequent dispatch. Anything after this point can assume
+  // that the following instruction was not one of these jumps.
+  void JumpDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| (JumpIfTrue or JumpIfFalse) at the current
+  // BytecodeOffset(), including the dispatch to the next bytecode.
+  void InlineJumpIfBoolean(Bytecode jump_bytecode);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -6,6 +6,7 @@
 
 #include <fstream>
 #include <memory>
+#include <vector>
 
 #include "builtins-generated/bytecodes-builtins-list.h"
 #include "src/ast/prettyprinter.h"
@@ -14,6 +15,7 @@
 #include "src/codegen/unoptimized-compilation-info.h"
 #include "src/common/globals.h"
 #include "src/execution/local-isolate.h"
+#include "src/heap/heap.h"
 #include "src/heap/parked-scope.h"
 #include "src/init/setup-isolate.h"
 #include "src/interpreter/bytecode-generator.h"
@@ -424,6 +426,70 @@ Handle<JSObject> Interpreter::GetDispatchCountersObject() {
   return counters_map;
 }
 
+Handle<JSObject> Interpreter::GetBytecodeHistogramObject() {
+  std::vector<size_t> counts(kNumberOfBytecodes, 0);
+  std::vector<size_t> pair_counts(kNumberOfBytecodes * kNumberOfBytecodes, 0);
+
+  {
+    HeapObjectIterator iterator(isolate_->heap());
+    for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!IsSharedFunctionInfo(obj)) continue;
+      Tagged<SharedFunctionInfo> shared = Cast<SharedFunctionInfo>(obj);
+      if (!shared->HasBytecodeArray()) continue;
+      Tagged<BytecodeArray> bytecode_array = shared->GetBytecodeArray(isolate_);
+      int previous = -1;
+      int offset = 0;
+      while (offset < bytecode_array->length()) {
+        Bytecode bytecode = Bytecodes::FromByte(bytecode_array->get(offset));
+        OperandScale operand_scale = OperandScale::kSingle;
+        if (Bytecodes::IsPrefixScalingBytecode(bytecode)) {
+          operand_scale = Bytecodes::PrefixBytecodeToOperandScale(bytecode);
+          bytecode = Bytecodes::FromByte(bytecode_array->get(++offset));
+        }
+        int index = Bytecodes::ToByte(bytecode);
+        counts[index]++;
+        if (previous >= 0) {
+          pair_counts[previous * kNumberOfBytecodes + index]++;
+        }
+        previous = index;
+        offset += Bytecodes::Size(bytecode, operand_scale);
+      }
+    }
+  }
+
+  // Output is a JSON-encoded object with two entries: "bytecodes" maps each
+  // bytecode to the number of times it occurs, and "pairs" maps each bytecode
+  // to an object that counts the bytecodes directly following it (in the same
+  // format as the dispatch counters). Only non-zero counts are included.
+  Factory* factory = isolate_->factory();
+  Handle<JSObject> histogram = factory->NewJSObjectWithNullProto();
+  Handle<JSObject> bytecodes = factory->NewJSObjectWithNullProto();
+  Handle<JSObject> pairs = factory->NewJSObjectWithNullProto();
+  for (int from_index = 0; from_index < kNumberOfBytecodes; ++from_index) {
+    if (counts[from_index] == 0) continue;
+    Bytecode from_bytecode = Bytecodes::FromByte(from_index);
+    JSObject::AddProperty(isolate_, bytecodes,
+                          Bytecodes::ToString(from_bytecode),
+                          factory->NewNumberFromSize(counts[from_index]),
+                          NONE);
+
+    Handle<JSObject> pairs_row = factory->NewJSObjectWithNullProto();
+    for (int to_index = 0; to_index < kNumberOfBytecodes; ++to_index) {
+      size_t count = pair_counts[from_index * kNumberOfBytecodes + to_index];
+      if (count == 0) continue;
+      JSObject::AddProperty(isolate_, pairs_row,
+                            Bytecodes::ToString(Bytecodes::FromByte(to_index)),
+                            factory->NewNumberFromSize(count), NONE);
+    }
+    JSObject::AddProperty(isolate_, pairs, Bytecodes::ToString(from_bytecode),
+                          pairs_row, NONE);
+  }
+  JSObject::AddProperty(isolate_, histogram, "bytecodes", bytecodes, NONE);
+  JSObject::AddProperty(isolate_, histogram, "pairs", pairs, NONE);
+  return histogram;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -71,6 +71,12 @@ class Interpreter {
 
   V8_EXPORT_PRIVATE Handle<JSObject> GetDispatchCountersObject();
 
+  // Returns a histogram of the bytecodes and of pairs of consecutive bytecodes
+  // in all bytecode arrays currently on the heap. Unlike the dispatch counters
+  // above, this doesn't require a special build, and is used to pick bytecode
+  // sequences worth handling with a dispatch lookahead.
+  V8_EXPORT_PRIVATE Handle<JSObject> GetBytecodeHistogramObject();
+
   void ForEachBytecode(const std::function<void(Bytecode, OperandScale)>& f);
 
   void Initialize();
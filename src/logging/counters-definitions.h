@@ -381,6 +381,10 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  SC(flushed_bytecode, V8.FlushedBytecode)                                     \
+  SC(flushed_bytecode_size, V8.FlushedBytecodeBytes)                           \
+  SC(flushed_baseline_code, V8.FlushedBaselineCode)                            \
+  SC(recompiled_after_flush, V8.RecompiledAfterFlush)                          \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
@@ -130,6 +130,19 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
         PrintGraph(std::cout, compilation_info, graph);
       }
     }
+
+    if (v8_flags.maglev_bounds_check_elimination) {
+      TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                   "V8.Maglev.BoundsCheckElimination");
+
+      GraphProcessor<BoundsCheckEliminationProcessor> bounds_check_elimination;
+      bounds_check_elimination.ProcessGraph(graph);
+
+      if (v8_flags.print_maglev_graphs) {
+        std::cout << "\nAfter bounds check elimination" << std::endl;
+        PrintGraph(std::cout, compilation_info, graph);
+      }
+    }
   }
 
 #ifdef DEBUG
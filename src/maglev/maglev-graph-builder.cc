@@ -410,6 +410,13 @@ class V8_NODISCARD MaglevGraphBuilder::DeoptFrameScope {
       case Builtin::kGetIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kCallIteratorWithFeedbackLazyDeoptContinuation:
       case Builtin::kArrayForEachLoopLazyDeoptContinuation:
+      case Builtin::kArraySomeLoopLazyDeoptContinuation:
+      case Builtin::kArrayEveryLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindLoopAfterCallbackLazyDeoptContinuation:
+      case Builtin::kArrayFindIndexLoopLazyDeoptContinuation:
+      case Builtin::kArrayFindIndexLoopAfterCallbackLazyDeoptContinuation:
+      case Builtin::kArrayReduceLoopLazyDeoptContinuation:
       case Builtin::kGenericLazyDeoptContinuation:
       case Builtin::kToBooleanLazyDeoptContinuation:
         return true;
@@ -5502,10 +5509,73 @@ ReduceResult MaglevGraphBuilder::TryBuildCheckInt32Condition(
       return EmitUnconditionalDeopt(reason);
     }
   }
+  if (v8_flags.maglev_bounds_check_elimination) {
+    KnownNodeAspects& aspects = known_node_aspects();
+    switch (condition) {
+      case AssertCondition::kLessThan:
+        if (aspects.IsKnownInt32LessThan(lhs, rhs, false)) {
+          return ReduceResult::Done();
+        }
+        break;
+      case AssertCondition::kLessThanEqual:
+        if (aspects.IsKnownInt32LessThan(lhs, rhs, true)) {
+          return ReduceResult::Done();
+        }
+        break;
+      case AssertCondition::kGreaterThan:
+        if (aspects.IsKnownInt32LessThan(rhs, lhs, false)) {
+          return ReduceResult::Done();
+        }
+        break;
+      case AssertCondition::kGreaterThanEqual:
+        if (aspects.IsKnownInt32LessThan(rhs, lhs, true)) {
+          return ReduceResult::Done();
+        }
+        break;
+      case AssertCondition::kUnsignedLessThan:
+        if (aspects.IsKnownInt32LessThan(lhs, rhs, false)) {
+          // Given lhs < rhs, the unsigned comparison can only fail if lhs is
+          // negative. Checking for that is cheaper, and it is often removed
+          // later on if lhs is an induction variable (see
+          // BoundsCheckEliminationProcessor).
+          return TryBuildCheckInt32Condition(lhs, GetInt32Constant(0),
+                                             AssertCondition::kGreaterThanEqual,
+                                             reason);
+        }
+        break;
+      default:
+        break;
+    }
+  }
   AddNewNode<CheckInt32Condition>({lhs, rhs}, condition, reason);
+  if (v8_flags.maglev_bounds_check_elimination) {
+    RecordKnownInt32Condition(lhs, rhs, condition);
+  }
   return ReduceResult::Done();
 }
 
+void MaglevGraphBuilder::RecordKnownInt32Condition(ValueNode* lhs,
+                                                   ValueNode* rhs,
+                                                   AssertCondition condition) {
+  KnownNodeAspects& aspects = known_node_aspects();
+  switch (condition) {
+    case AssertCondition::kLessThan:
+      aspects.RecordInt32LessThan(lhs, rhs, false);
+      break;
+    case AssertCondition::kLessThanEqual:
+      aspects.RecordInt32LessThan(lhs, rhs, true);
+      break;
+    case AssertCondition::kGreaterThan:
+      aspects.RecordInt32LessThan(rhs, lhs, false);
+      break;
+    case AssertCondition::kGreaterThanEqual:
+      aspects.RecordInt32LessThan(rhs, lhs, true);
+      break;
+    default:
+      break;
+  }
+}
+
 ValueNode* MaglevGraphBuilder::BuildLoadElements(ValueNode* object) {
   ReduceResult known_elements =
       TryFindLoadedProperty(known_node_aspects().loaded_properties, object,
@@ -7530,8 +7600,65 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayIsArray(
   return ReduceResult::Fail();
 }
 
-ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
-    compiler::JSFunctionRef target, CallArguments& args) {
+ReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
+    ArrayIteratingBuiltin builtin, compiler::JSFunctionRef target,
+    CallArguments& args) {
+  const char* name;
+  // Resumes the loop at a given index, used for eager deopts in the loop.
+  Builtin eager_continuation;
+  // Used for lazy deopts in the callable check.
+  Builtin lazy_continuation;
+  // Used for lazy deopts in the callback, continues with its result.
+  Builtin after_callback_continuation;
+  switch (builtin) {
+    case ArrayIteratingBuiltin::kForEach:
+      name = "Array.prototype.forEach";
+      eager_continuation = Builtin::kArrayForEachLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayForEachLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltin::kSome:
+      name = "Array.prototype.some";
+      eager_continuation = Builtin::kArraySomeLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArraySomeLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltin::kEvery:
+      name = "Array.prototype.every";
+      eager_continuation = Builtin::kArrayEveryLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayEveryLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+    case ArrayIteratingBuiltin::kFind:
+      name = "Array.prototype.find";
+      eager_continuation = Builtin::kArrayFindLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayFindLoopLazyDeoptContinuation;
+      after_callback_continuation =
+          Builtin::kArrayFindLoopAfterCallbackLazyDeoptContinuation;
+      break;
+    case ArrayIteratingBuiltin::kFindIndex:
+      name = "Array.prototype.findIndex";
+      eager_continuation = Builtin::kArrayFindIndexLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayFindIndexLoopLazyDeoptContinuation;
+      after_callback_continuation =
+          Builtin::kArrayFindIndexLoopAfterCallbackLazyDeoptContinuation;
+      break;
+    case ArrayIteratingBuiltin::kReduce:
+      name = "Array.prototype.reduce";
+      eager_continuation = Builtin::kArrayReduceLoopEagerDeoptContinuation;
+      lazy_continuation = Builtin::kArrayReduceLoopLazyDeoptContinuation;
+      after_callback_continuation = lazy_continuation;
+      break;
+  }
+  const bool is_reduce = builtin == ArrayIteratingBuiltin::kReduce;
+  // find and findIndex visit holes as undefined, the others skip them.
+  const bool skips_holes = builtin != ArrayIteratingBuiltin::kFind &&
+                           builtin != ArrayIteratingBuiltin::kFindIndex;
+  // All but forEach and reduce can leave the loop depending on the result of
+  // the callback.
+  const bool has_early_exit =
+      builtin != ArrayIteratingBuiltin::kForEach && !is_reduce;
+
   if (!CanSpeculateCall()) {
     return ReduceResult::Fail();
   }
@@ -7539,11 +7666,12 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   ValueNode* receiver = args.receiver();
   if (!receiver) return ReduceResult::Fail();
 
-  if (args.count() < 1) {
+  // TODO(v8:7700): Support reduce without an initial value, which starts at
+  // the first non-hole element.
+  if (args.count() < (is_reduce ? 2 : 1)) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - not enough "
-                   "arguments"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - not enough arguments" << std::endl;
     }
     return ReduceResult::Fail();
   }
@@ -7551,9 +7679,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   auto node_info = known_node_aspects().TryGetInfoFor(receiver);
   if (!node_info || !node_info->possible_maps_are_known()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - receiver "
-                   "map is unknown"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - receiver map is unknown" << std::endl;
     }
     return ReduceResult::Fail();
   }
@@ -7562,19 +7689,27 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   if (!CanInlineArrayIteratingBuiltin(broker(), node_info->possible_maps(),
                                       &elements_kind)) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - doesn't "
-                   "support fast array iteration or incompatible maps"
+      std::cout << "  ! Failed to reduce " << name
+                << " - doesn't support fast array iteration or incompatible "
+                   "maps"
                 << std::endl;
     }
     return ReduceResult::Fail();
   }
 
+  if (!skips_holes && elements_kind == HOLEY_DOUBLE_ELEMENTS) {
+    if (v8_flags.trace_maglev_graph_building) {
+      std::cout << "  ! Failed to reduce " << name
+                << " - holey double elements" << std::endl;
+    }
+    return ReduceResult::Fail();
+  }
+
   // TODO(leszeks): May only be needed for holey elements kinds.
   if (!broker()->dependencies()->DependOnNoElementsProtector()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - invalidated "
-                   "no elements protector"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - invalidated no elements protector" << std::endl;
     }
     return ReduceResult::Fail();
   }
@@ -7582,26 +7717,41 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   ValueNode* callback = args[0];
   if (!callback->is_tagged()) {
     if (v8_flags.trace_maglev_graph_building) {
-      std::cout << "  ! Failed to reduce Array.prototype.forEach - callback is "
-                   "untagged value"
-                << std::endl;
+      std::cout << "  ! Failed to reduce " << name
+                << " - callback is untagged value" << std::endl;
     }
     return ReduceResult::Fail();
   }
 
-  ValueNode* this_arg =
-      args.count() > 1 ? args[1] : GetRootConstant(RootIndex::kUndefinedValue);
+  ValueNode* this_arg = nullptr;
+  if (!is_reduce) {
+    this_arg = args.count() > 1 ? args[1]
+                                : GetRootConstant(RootIndex::kUndefinedValue);
+  }
 
   ValueNode* original_length = BuildLoadJSArrayLength(receiver);
 
+  // Returns the parameters of the continuation builtins, which resume the
+  // loop at index {k}. {extra} is the accumulator of reduce for eager deopts,
+  // and the found value of find and findIndex after the callback.
+  auto continuation_parameters = [&](ValueNode* k, ValueNode* extra) {
+    base::SmallVector<ValueNode*, 6> parameters;
+    parameters.push_back(receiver);
+    parameters.push_back(callback);
+    if (this_arg) parameters.push_back(this_arg);
+    parameters.push_back(k);
+    parameters.push_back(original_length);
+    if (extra) parameters.push_back(extra);
+    return parameters;
+  };
+
   // Elide the callable check if the node is known callable.
   EnsureType(callback, NodeType::kCallable, [&](NodeType old_type) {
     // ThrowIfNotCallable is wrapped in a lazy_deopt_scope to make sure the
     // exception has the right call stack.
     DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>({receiver, callback, this_arg,
-                                    GetSmiConstant(0), original_length}));
+        this, lazy_continuation, target,
+        base::VectorOf(continuation_parameters(GetSmiConstant(0), nullptr)));
     AddNewNode<ThrowIfNotCallable>({callback});
   });
 
@@ -7611,12 +7761,15 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   bool receiver_maps_were_unstable = node_info->possible_maps_are_unstable();
   PossibleMaps receiver_maps_before_loop(node_info->possible_maps());
 
-  // Create a sub graph builder with two variable (index and length)
-  MaglevSubGraphBuilder sub_builder(this, 2);
+  // Create a sub graph builder with three variables (index, length and the
+  // result, which is the accumulator for reduce).
+  MaglevSubGraphBuilder sub_builder(this, 3);
   MaglevSubGraphBuilder::Variable var_index(0);
   MaglevSubGraphBuilder::Variable var_length(1);
+  MaglevSubGraphBuilder::Variable var_result(2);
 
-  MaglevSubGraphBuilder::Label loop_end(&sub_builder, 1);
+  MaglevSubGraphBuilder::Label loop_end(&sub_builder, has_early_exit ? 2 : 1,
+                                        {&var_result});
 
   // ```
   // index = 0
@@ -7624,8 +7777,10 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   // ```
   sub_builder.set(var_index, GetSmiConstant(0));
   sub_builder.set(var_length, original_length);
+  if (is_reduce) sub_builder.set(var_result, args[1]);
   MaglevSubGraphBuilder::LoopLabel loop_header =
-      sub_builder.BeginLoop({&var_index, &var_length});
+      is_reduce ? sub_builder.BeginLoop({&var_index, &var_length, &var_result})
+                : sub_builder.BeginLoop({&var_index, &var_length});
 
   // Reset known state that is cleared by BeginLoop, but is known to be true on
   // the first iteration, and will be re-checked at the end of the loop.
@@ -7646,6 +7801,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
                       sub_builder.get(var_length), false,
                       compiler::AccessMode::kLoad);
 
+  ValueNode* accumulator = is_reduce ? sub_builder.get(var_result) : nullptr;
+
   // ```
   // if (index_int32 < length_int32)
   //   fallthrough
@@ -7656,6 +7813,23 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   EnsureType(index_tagged, NodeType::kSmi);
   ValueNode* index_int32 = GetInt32(index_tagged);
 
+  switch (builtin) {
+    case ArrayIteratingBuiltin::kForEach:
+    case ArrayIteratingBuiltin::kFind:
+      sub_builder.set(var_result, GetRootConstant(RootIndex::kUndefinedValue));
+      break;
+    case ArrayIteratingBuiltin::kSome:
+      sub_builder.set(var_result, GetBooleanConstant(false));
+      break;
+    case ArrayIteratingBuiltin::kEvery:
+      sub_builder.set(var_result, GetBooleanConstant(true));
+      break;
+    case ArrayIteratingBuiltin::kFindIndex:
+      sub_builder.set(var_result, GetSmiConstant(-1));
+      break;
+    case ArrayIteratingBuiltin::kReduce:
+      break;
+  }
   sub_builder.GotoIfFalse<BranchIfInt32Compare>(
       &loop_end, {index_int32, original_length_int32}, Operation::kLessThan);
 
@@ -7669,9 +7843,8 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // possible array length is less than int32 max value. Add a new
     // Int32Increment that asserts no overflow instead of deopting.
     DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, index_int32, original_length}));
+        this, eager_continuation, target,
+        base::VectorOf(continuation_parameters(index_int32, accumulator)));
     next_index_int32 = AddNewNode<Int32IncrementWithOverflow>({index_int32});
     EnsureType(next_index_int32, NodeType::kSmi);
   }
@@ -7689,33 +7862,69 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   }
 
   std::optional<MaglevSubGraphBuilder::Label> skip_call;
-  if (IsHoleyElementsKind(elements_kind)) {
+  if (IsHoleyElementsKind(elements_kind) && skips_holes) {
     // ```
     // if (element is hole) goto skip_call
     // ```
-    skip_call.emplace(
-        &sub_builder, 2,
-        std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+    if (is_reduce) {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+              &var_length, &var_result});
+    } else {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+              &var_length});
+    }
     if (elements_kind == HOLEY_DOUBLE_ELEMENTS) {
       sub_builder.GotoIfTrue<BranchIfFloat64IsHole>(&*skip_call, {element});
     } else {
       sub_builder.GotoIfTrue<BranchIfRootConstant>(&*skip_call, {element},
                                                    RootIndex::kTheHoleValue);
     }
+  } else if (IsHoleyElementsKind(elements_kind)) {
+    // ```
+    // if (element is hole) element = undefined
+    // ```
+    element = BuildConvertHoleToUndefined(element);
   }
 
   // ```
-  // callback(this_arg, element, array)
+  // result = callback(this_arg, element, index, array)
   // ```
   ReduceResult result;
   {
+    // some and every re-check the result of the callback at the current index
+    // when continuing after a lazy deopt, the others continue at the next
+    // index.
+    ValueNode* continuation_index = next_index_int32;
+    ValueNode* found_value = nullptr;
+    switch (builtin) {
+      case ArrayIteratingBuiltin::kSome:
+      case ArrayIteratingBuiltin::kEvery:
+        continuation_index = index_int32;
+        break;
+      case ArrayIteratingBuiltin::kFind:
+        found_value = element;
+        break;
+      case ArrayIteratingBuiltin::kFindIndex:
+        found_value = index_tagged;
+        break;
+      case ArrayIteratingBuiltin::kForEach:
+      case ArrayIteratingBuiltin::kReduce:
+        break;
+    }
     DeoptFrameScope lazy_deopt_scope(
-        this, Builtin::kArrayForEachLoopLazyDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
+        this, after_callback_continuation, target,
+        base::VectorOf(
+            continuation_parameters(continuation_index, found_value)));
 
     CallArguments call_args =
-        args.count() < 2
+        is_reduce
+            ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
+                            {accumulator, element, index_tagged, receiver})
+        : args.count() < 2
             ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
                             {element, index_tagged, receiver})
             : CallArguments(ConvertReceiverMode::kAny,
@@ -7732,7 +7941,48 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   DCHECK_IMPLIES(result.IsDoneWithAbort(), current_block_ == nullptr);
 
   // No need to finish the loop if this code is unreachable.
-  if (!result.IsDoneWithAbort()) {
+  if (result.IsDoneWithAbort()) {
+    if (has_early_exit) sub_builder.ReducePredecessorCount(&loop_end);
+  } else {
+    ValueNode* next_accumulator = nullptr;
+    if (is_reduce) {
+      // ```
+      // accumulator = result
+      // ```
+      next_accumulator = result.value();
+      sub_builder.set(var_result, next_accumulator);
+    } else if (has_early_exit) {
+      // ```
+      // if (ToBoolean(result)) goto end  // !ToBoolean(result) for every
+      // ```
+      ValueNode* exit_condition;
+      ValueNode* exit_value;
+      switch (builtin) {
+        case ArrayIteratingBuiltin::kSome:
+          exit_condition = BuildToBoolean(result.value());
+          exit_value = GetBooleanConstant(true);
+          break;
+        case ArrayIteratingBuiltin::kEvery:
+          exit_condition = BuildToBoolean</* flip */ true>(result.value());
+          exit_value = GetBooleanConstant(false);
+          break;
+        case ArrayIteratingBuiltin::kFind:
+          exit_condition = BuildToBoolean(result.value());
+          exit_value = GetTaggedValue(element);
+          break;
+        case ArrayIteratingBuiltin::kFindIndex:
+          exit_condition = BuildToBoolean(result.value());
+          exit_value = index_tagged;
+          break;
+        case ArrayIteratingBuiltin::kForEach:
+        case ArrayIteratingBuiltin::kReduce:
+          UNREACHABLE();
+      }
+      sub_builder.set(var_result, exit_value);
+      sub_builder.GotoIfTrue<BranchIfRootConstant>(
+          &loop_end, {exit_condition}, RootIndex::kTrueValue);
+    }
+
     // If any of the receiver's maps were unstable maps, we have to re-check the
     // maps on each iteration, in case the callback changed them. That said, we
     // know that the maps are valid on the first iteration, so we can rotate the
@@ -7757,10 +8007,9 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
     // Make sure to finish the loop if we eager deopt in the map check or index
     // check.
     DeoptFrameScope eager_deopt_scope(
-        this, Builtin::kArrayForEachLoopEagerDeoptContinuation, target,
-        base::VectorOf<ValueNode*>(
-            {receiver, callback, this_arg, next_index_int32, original_length}));
-
+        this, eager_continuation, target,
+        base::VectorOf(
+            continuation_parameters(next_index_int32, next_accumulator)));
     if (recheck_maps_after_call) {
       // Build the CheckMap manually, since we're doing it with already known
       // maps rather than feedback, and we don't need to update known node
@@ -7807,7 +8056,43 @@ ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
   // ```
   sub_builder.Bind(&loop_end);
 
-  return GetRootConstant(RootIndex::kUndefinedValue);
+  return sub_builder.get(var_result);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayForEach(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kForEach, target,
+                                        args);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArraySome(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kSome, target,
+                                        args);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayEvery(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kEvery, target,
+                                        args);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeFind(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kFind, target,
+                                        args);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeFindIndex(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kFindIndex,
+                                        target, args);
+}
+
+ReduceResult MaglevGraphBuilder::TryReduceArrayReduce(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  return TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin::kReduce, target,
+                                        args);
 }
 
 ReduceResult MaglevGraphBuilder::TryReduceArrayIteratorPrototypeNext(
@@ -12742,10 +13027,10 @@ MaglevGraphBuilder::BranchResult MaglevGraphBuilder::BuildBranchIfRootConstant(
           builder, node->Cast<TaggedNotEqual>()->lhs().node(),
           node->Cast<TaggedNotEqual>()->rhs().node());
     case Opcode::kInt32Compare:
-      return builder.Build<BranchIfInt32Compare>(
-          {node->Cast<Int32Compare>()->left_input().node(),
-           node->Cast<Int32Compare>()->right_input().node()},
-          node->Cast<Int32Compare>()->operation());
+      return BuildBranchIfInt32Compare(
+          builder, node->Cast<Int32Compare>()->operation(),
+          node->Cast<Int32Compare>()->left_input().node(),
+          node->Cast<Int32Compare>()->right_input().node());
     case Opcode::kFloat64Compare:
       return builder.Build<BranchIfFloat64Compare>(
           {node->Cast<Float64Compare>()->left_input().node(),
@@ -12983,7 +13268,52 @@ MaglevGraphBuilder::BranchResult MaglevGraphBuilder::BuildBranchIfInt32Compare(
           CompareInt32(lhs_const.value(), rhs_const.value(), op));
     }
   }
-  return builder.Build<BranchIfInt32Compare>({lhs, rhs}, op);
+  BranchResult result = builder.Build<BranchIfInt32Compare>({lhs, rhs}, op);
+  // If the fallthrough is not a merge point, we are now in a block that is only
+  // reached through one of the edges of the branch, and we know the outcome of
+  // the comparison.
+  if (v8_flags.maglev_bounds_check_elimination && current_block_ != nullptr) {
+    switch (builder.GetCurrentBranchType()) {
+      case BranchType::kBranchIfFalse:
+        break;
+      case BranchType::kBranchIfTrue:
+        switch (op) {
+          case Operation::kLessThan:
+            op = Operation::kGreaterThanOrEqual;
+            break;
+          case Operation::kLessThanOrEqual:
+            op = Operation::kGreaterThan;
+            break;
+          case Operation::kGreaterThan:
+            op = Operation::kLessThanOrEqual;
+            break;
+          case Operation::kGreaterThanOrEqual:
+            op = Operation::kLessThan;
+            break;
+          default:
+            return result;
+        }
+        break;
+    }
+    switch (op) {
+      case Operation::kLessThan:
+        RecordKnownInt32Condition(lhs, rhs, AssertCondition::kLessThan);
+        break;
+      case Operation::kLessThanOrEqual:
+        RecordKnownInt32Condition(lhs, rhs, AssertCondition::kLessThanEqual);
+        break;
+      case Operation::kGreaterThan:
+        RecordKnownInt32Condition(lhs, rhs, AssertCondition::kGreaterThan);
+        break;
+      case Operation::kGreaterThanOrEqual:
+        RecordKnownInt32Condition(lhs, rhs,
+                                  AssertCondition::kGreaterThanEqual);
+        break;
+      default:
+        break;
+    }
+  }
+  return result;
 }
 
 MaglevGraphBuilder::BranchResult MaglevGraphBuilder::BuildBranchIfUint32Compare(
@@ -1903,12 +1903,17 @@ class MaglevGraphBuilder {
 
 #define MAGLEV_REDUCED_BUILTIN(V)              \
   V(ArrayConstructor)                          \
+  V(ArrayEvery)                                \
   V(ArrayForEach)                              \
   V(ArrayIsArray)                              \
   V(ArrayIteratorPrototypeNext)                \
   V(ArrayPrototypeEntries)                     \
+  V(ArrayPrototypeFind)                        \
+  V(ArrayPrototypeFindIndex)                   \
   V(ArrayPrototypeKeys)                        \
   V(ArrayPrototypeValues)                      \
+  V(ArrayReduce)                               \
+  V(ArraySome)                                 \
   V(DataViewPrototypeGetInt8)                  \
   V(DataViewPrototypeSetInt8)                  \
   V(DataViewPrototypeGetInt16)                 \
@@ -1949,6 +1954,20 @@ class MaglevGraphBuilder {
 
   ReduceResult TryReduceGetProto(ValueNode* node);
 
+  // Array.prototype builtins that call a callback for each element, which are
+  // built as a loop with the callback call inlined if possible.
+  enum class ArrayIteratingBuiltin {
+    kForEach,
+    kSome,
+    kEvery,
+    kFind,
+    kFindIndex,
+    kReduce,
+  };
+  ReduceResult TryReduceArrayIteratingBuiltin(ArrayIteratingBuiltin builtin,
+                                              compiler::JSFunctionRef target,
+                                              CallArguments& args);
+
   template <typename MapKindsT, typename IndexToElementsKindFunc,
             typename BuildKindSpecificFunc>
   ReduceResult BuildJSArrayBuiltinMapSwitchOnElementsKind(
@@ -2252,6 +2271,8 @@ class MaglevGraphBuilder {
   ReduceResult TryBuildCheckInt32Condition(ValueNode* lhs, ValueNode* rhs,
                                            AssertCondition condition,
                                            DeoptimizeReason reason);
+  void RecordKnownInt32Condition(ValueNode* lhs, ValueNode* rhs,
+                                 AssertCondition condition);
 
   ReduceResult TryBuildPropertyLoad(
       ValueNode* receiver, ValueNode* lookup_start_object,
@@ -89,6 +89,11 @@ void KnownNodeAspects::Merge(const KnownNodeAspects& other, Zone* zone) {
     }
   }
   DestructivelyIntersect(loaded_context_slots, other.loaded_context_slots);
+  DestructivelyIntersect(known_int32_less_than, other.known_int32_less_than,
+                         [](bool& lhs_or_equal, bool rhs_or_equal) {
+                           lhs_or_equal = lhs_or_equal || rhs_or_equal;
+                           return true;
+                         });
 }
 
 namespace {
@@ -132,6 +137,10 @@ KnownNodeAspects::KnownNodeAspects(const KnownNodeAspects& other,
       loaded_properties(zone),
       loaded_context_constants(other.loaded_context_constants),
       loaded_context_slots(zone),
+      // The comparisons were established on paths dominating the loop header
+      // and are about values defined outside of the loop, so they also hold
+      // on the back edge.
+      known_int32_less_than(other.known_int32_less_than),
       available_expressions(zone),
       may_have_aliasing_contexts_(
           KnownNodeAspects::ContextSlotLoadsAlias::None),
@@ -467,6 +467,24 @@ struct KnownNodeAspects {
   using LoadedContextSlots = ZoneMap<LoadedContextSlotsKey, ValueNode*>;
   LoadedContextSlots loaded_context_slots;
 
+  // Signed Int32 comparisons known to hold on the current path, e.g. because
+  // we are on the true edge of a branch that tested them. Maps (lhs, rhs) to
+  // whether only lhs <= rhs (rather than lhs < rhs) is known. These are facts
+  // about SSA values, so they stay valid across side-effecting calls.
+  using KnownInt32LessThanKey = std::tuple<ValueNode*, ValueNode*>;
+  ZoneMap<KnownInt32LessThanKey, bool> known_int32_less_than;
+  void RecordInt32LessThan(ValueNode* lhs, ValueNode* rhs, bool or_equal) {
+    auto [it, inserted] =
+        known_int32_less_than.emplace(std::tuple{lhs, rhs}, or_equal);
+    if (!inserted) it->second = it->second && or_equal;
+  }
+  bool IsKnownInt32LessThan(ValueNode* lhs, ValueNode* rhs,
+                            bool or_equal) const {
+    auto it = known_int32_less_than.find(std::tuple{lhs, rhs});
+    if (it == known_int32_less_than.end()) return false;
+    return or_equal || !it->second;
+  }
+
   struct AvailableExpression {
     NodeBase* node;
     uint32_t effect_epoch;
@@ -487,6 +505,7 @@ struct KnownNodeAspects {
         loaded_properties(zone),
         loaded_context_constants(zone),
         loaded_context_slots(zone),
+        known_int32_less_than(zone),
         available_expressions(zone),
         may_have_aliasing_contexts_(ContextSlotLoadsAlias::None),
         effect_epoch_(0),
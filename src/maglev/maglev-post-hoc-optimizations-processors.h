@@ -5,6 +5,9 @@
 #ifndef V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 #define V8_MAGLEV_MAGLEV_POST_HOC_OPTIMIZATIONS_PROCESSORS_H_
 
+#include <unordered_map>
+#include <unordered_set>
+
 #include "src/compiler/heap-refs.h"
 #include "src/maglev/maglev-compilation-info.h"
 #include "src/maglev/maglev-graph-builder.h"
@@ -165,6 +168,112 @@ class LoopOptimizationProcessor {
   bool was_deoptimized;
 };
 
+// A light-weight range analysis that removes `x >= 0` checks on Int32 values
+// that are known to be non-negative. The graph builder reduces bounds checks
+// on indices that are known to be below the length to such checks, and the
+// index of a counted loop typically is a phi that starts at a non-negative
+// constant and is only ever incremented. Since the increments deopt on
+// overflow, such a phi can never become negative.
+//
+// This runs after phi untagging, since the analysis relies on phis and their
+// inputs being Int32.
+class BoundsCheckEliminationProcessor {
+ public:
+  void PreProcessGraph(Graph* graph) {}
+  void PostProcessGraph(Graph* graph) {}
+  BlockProcessResult PreProcessBasicBlock(BasicBlock* block) {
+    return BlockProcessResult::kContinue;
+  }
+  void PostPhiProcessing() {}
+
+  ProcessResult Process(CheckInt32Condition* node,
+                        const ProcessingState& state) {
+    if (node->condition() != AssertCondition::kGreaterThanEqual) {
+      return ProcessResult::kContinue;
+    }
+    Int32Constant* limit =
+        SkipIdentities(node->right_input().node())->TryCast<Int32Constant>();
+    if (limit == nullptr || limit->value() > 0) {
+      return ProcessResult::kContinue;
+    }
+    if (!IsNonNegative(node->left_input().node())) {
+      return ProcessResult::kContinue;
+    }
+    node->left_input().clear();
+    node->right_input().clear();
+    return ProcessResult::kRemove;
+  }
+
+  template <typename NodeT>
+  ProcessResult Process(NodeT* node, const ProcessingState& state) {
+    return ProcessResult::kContinue;
+  }
+
+ private:
+  static constexpr int kMaxDepth = 8;
+
+  static ValueNode* SkipIdentities(ValueNode* node) {
+    while (node->Is<Identity>()) node = node->input(0).node();
+    return node;
+  }
+
+  bool IsNonNegative(ValueNode* node) {
+    node = SkipIdentities(node);
+    auto it = non_negative_.find(node);
+    if (it != non_negative_.end()) return it->second;
+    bool result = IsNonNegative(node, 0);
+    DCHECK(visiting_phis_.empty());
+    non_negative_.emplace(node, result);
+    return result;
+  }
+
+  bool IsNonNegative(ValueNode* node, int depth) {
+    node = SkipIdentities(node);
+    if (node->value_representation() != ValueRepresentation::kInt32) {
+      return false;
+    }
+    if (depth > kMaxDepth) return false;
+    switch (node->opcode()) {
+      case Opcode::kInt32Constant:
+        return node->Cast<Int32Constant>()->value() >= 0;
+      case Opcode::kStringLength:
+        return true;
+      case Opcode::kInt32IncrementWithOverflow:
+        return IsNonNegative(node->input(0).node(), depth + 1);
+      case Opcode::kInt32AddWithOverflow:
+        return IsNonNegative(node->input(0).node(), depth + 1) &&
+               IsNonNegative(node->input(1).node(), depth + 1);
+      case Opcode::kInt32BitwiseAnd:
+        return IsNonNegative(node->input(0).node(), depth + 1) ||
+               IsNonNegative(node->input(1).node(), depth + 1);
+      case Opcode::kPhi: {
+        // Assume that the phi is non-negative while looking at its inputs. For
+        // a loop phi, this proves by induction over the iterations that it
+        // stays non-negative, as long as its inputs only add non-negative
+        // values to it.
+        Phi* phi = node->Cast<Phi>();
+        if (!visiting_phis_.insert(phi).second) return true;
+        bool result = true;
+        for (Input& input : *phi) {
+          if (!IsNonNegative(input.node(), depth + 1)) {
+            result = false;
+            break;
+          }
+        }
+        visiting_phis_.erase(phi);
+        return result;
+      }
+      default:
+        return false;
+    }
+  }
+
+  // Only holds results of top-level queries, since results computed while a
+  // phi is assumed to be non-negative depend on that assumption.
+  std::unordered_map<ValueNode*, bool> non_negative_;
+  std::unordered_set<Phi*> visiting_phis_;
+};
+
 template <typename NodeT>
 constexpr bool CanBeStoreToNonEscapedObject() {
   return std::is_same_v<NodeT, StoreMap> ||
@@ -4,6 +4,8 @@
 
 #include "src/maglev/maglev-regalloc.h"
 
+#include <algorithm>
+#include <limits>
 #include <sstream>
 #include <type_traits>
 
@@ -202,7 +204,14 @@ bool IsDeadNodeToSkip(Node* node) {
 
 StraightForwardRegisterAllocator::StraightForwardRegisterAllocator(
     MaglevCompilationInfo* compilation_info, Graph* graph)
-    : compilation_info_(compilation_info), graph_(graph) {
+    : compilation_info_(compilation_info),
+      graph_(graph),
+      use_spill_costs_(
+          v8_flags.maglev_regalloc_spill_costs &&
+          graph->num_blocks() > 0 &&
+          graph->last_block()->control_node()->id() <=
+              static_cast<NodeIdT>(
+                  v8_flags.maglev_regalloc_spill_costs_max_graph_size)) {
   ComputePostDominatingHoles();
   AllocateRegisters();
   uint32_t tagged_stack_slots = tagged_.top;
@@ -403,6 +412,7 @@ void StraightForwardRegisterAllocator::AllocateRegisters() {
   for (block_it_ = graph_->begin(); block_it_ != graph_->end(); ++block_it_) {
     BasicBlock* block = *block_it_;
     current_node_ = nullptr;
+    if (use_spill_costs_) UpdateCurrentLoop(block);
 
     // Restore mergepoint state.
     if (block->has_state()) {
@@ -1675,6 +1685,47 @@ void StraightForwardRegisterAllocator::AllocateSpillSlot(ValueNode* node) {
                                          representation, free_slot));
 }
 
+void StraightForwardRegisterAllocator::UpdateCurrentLoop(BasicBlock* block) {
+  while (!loops_.empty() && loops_.back().last_id < block->first_id()) {
+    loops_.pop_back();
+  }
+  if (!block->is_loop() || block->predecessor_count() == 0) return;
+  ControlNode* back_edge = block->backedge_predecessor()->control_node();
+  if (!back_edge->Is<JumpLoop>()) return;
+  loops_.push_back({block->first_id(), back_edge->id()});
+}
+
+bool StraightForwardRegisterAllocator::IsInCurrentLoop(NodeIdT id) const {
+  if (loops_.empty()) return false;
+  return id >= loops_.back().first_id && id <= loops_.back().last_id;
+}
+
+// static
+double StraightForwardRegisterAllocator::EvictionPriority(
+    NodeIdT distance, bool needs_spill_store, bool is_defined_in_loop,
+    bool is_next_used_in_loop) {
+  double cost = kBaseEvictionCost;
+  // Spill stores are emitted at the definition, so if the value is defined in
+  // the current loop, the store is executed on every iteration.
+  if (needs_spill_store) {
+    cost += is_defined_in_loop ? kSpillStoreInLoopCost : kSpillStoreCost;
+  }
+  // If the next use is in the current loop, the value will have to be
+  // reloaded there, possibly on every iteration.
+  if (is_next_used_in_loop) cost += kReloadInLoopCost;
+  return std::max<NodeIdT>(distance, 1) / cost;
+}
+
+double StraightForwardRegisterAllocator::EvictionPriority(ValueNode* value) {
+  if (value->has_no_more_uses()) return std::numeric_limits<double>::max();
+  NodeIdT next_use = value->current_next_use();
+  NodeIdT current_id = current_node_ ? current_node_->id() : 0;
+  NodeIdT distance = next_use > current_id ? next_use - current_id : 1;
+  return EvictionPriority(distance, !value->is_loadable(),
+                          IsInCurrentLoop(value->id()),
+                          IsInCurrentLoop(next_use));
+}
+
 template <typename RegisterT>
 RegisterT StraightForwardRegisterAllocator::PickRegisterToFree(
     RegListBase<RegisterT> reserved) {
@@ -1683,6 +1734,7 @@ RegisterT StraightForwardRegisterAllocator::PickRegisterToFree(
     printing_visitor_->os() << "  need to free a register... ";
   }
   int furthest_use = 0;
+  double best_priority = -1;
   RegisterT best = RegisterT::no_reg();
   for (RegisterT reg : (registers.used() - reserved)) {
     ValueNode* value = registers.GetValue(reg);
@@ -1695,7 +1747,14 @@ RegisterT StraightForwardRegisterAllocator::PickRegisterToFree(
       break;
     }
     int use = value->current_next_use();
-    if (use > furthest_use) {
+    if (use_spill_costs_) {
+      double priority = EvictionPriority(value);
+      if (priority > best_priority) {
+        best_priority = priority;
+        furthest_use = use;
+        best = reg;
+      }
+    } else if (use > furthest_use) {
       furthest_use = use;
       best = reg;
     }
@@ -5,6 +5,8 @@
 #ifndef V8_MAGLEV_MAGLEV_REGALLOC_H_
 #define V8_MAGLEV_MAGLEV_REGALLOC_H_
 
+#include <vector>
+
 #include "src/codegen/reglist.h"
 #include "src/compiler/backend/instruction.h"
 #include "src/maglev/maglev-compilation-info.h"
@@ -144,6 +146,19 @@ class StraightForwardRegisterAllocator {
                                    Graph* graph);
   ~StraightForwardRegisterAllocator();
 
+  // How attractive it is to free a register whose value is next used
+  // {distance} nodes from now, used by --maglev-regalloc-spill-costs. The
+  // distance is divided by the estimated cost of the spill and reload code
+  // that freeing the register causes, where code that ends up in the current
+  // loop counts as more expensive.
+  static constexpr double kBaseEvictionCost = 1;
+  static constexpr double kSpillStoreCost = 1;
+  static constexpr double kSpillStoreInLoopCost = 4;
+  static constexpr double kReloadInLoopCost = 1;
+  static double EvictionPriority(NodeIdT distance, bool needs_spill_store,
+                                 bool is_defined_in_loop,
+                                 bool is_next_used_in_loop);
+
  private:
   RegisterFrameState<Register> general_registers_;
   RegisterFrameState<DoubleRegister> double_registers_;
@@ -223,6 +238,12 @@ class StraightForwardRegisterAllocator {
   template <typename RegisterT>
   RegisterT PickRegisterToFree(RegListBase<RegisterT> reserved);
 
+  // Keeps track of the innermost loop containing {block}.
+  void UpdateCurrentLoop(BasicBlock* block);
+  bool IsInCurrentLoop(NodeIdT id) const;
+  // EvictionPriority of the register holding {value}.
+  double EvictionPriority(ValueNode* value);
+
   template <typename RegisterT>
   RegisterFrameState<RegisterT>& GetRegisterFrameState() {
     if constexpr (std::is_same<RegisterT, Register>::value) {
@@ -294,6 +315,18 @@ class StraightForwardRegisterAllocator {
   NodeIterator node_it_;
   // The current node, whether a Node in the body or the ControlNode.
   NodeBase* current_node_;
+
+  // Whether to pick registers to free based on EvictionPriority, rather than
+  // only on the distance to the next use. This is disabled for large graphs to
+  // keep allocation time predictable.
+  const bool use_spill_costs_;
+  // The loops containing the current block, innermost last, as ranges of node
+  // ids from the loop header to its JumpLoop.
+  struct LoopRange {
+    NodeIdT first_id;
+    NodeIdT last_id;
+  };
+  std::vector<LoopRange> loops_;
 };
 
 }  // namespace maglev
@@ -36,6 +36,7 @@ InstructionStream::WriteBarrierPromise InstructionStream::RelocateFromDesc(
     Address constant_pool, const DisallowGarbageCollection& no_gc) {
   WriteBarrierPromise write_barrier_promise;
   Assembler* origin = desc.origin;
+  size_t next_embedded_object = 0;
   const int mode_mask = RelocInfo::PostCodegenRelocationMask();
   for (WritableRelocIterator it(jit_allocation, *this, constant_pool,
                                 mode_mask);
@@ -45,7 +46,10 @@ InstructionStream::WriteBarrierPromise InstructionStream::RelocateFromDesc(
 
     RelocInfo::Mode mode = it.rinfo()->rmode();
     if (RelocInfo::IsEmbeddedObjectMode(mode)) {
-      DirectHandle<HeapObject> p = it.rinfo()->target_object_handle(origin);
+      DirectHandle<HeapObject> p =
+          desc.embedded_objects.empty()
+              ? it.rinfo()->target_object_handle(origin)
+              : desc.embedded_objects[next_embedded_object++];
       it.rinfo()->set_target_object(*this, *p, UNSAFE_SKIP_WRITE_BARRIER,
                                     SKIP_ICACHE_FLUSH);
       write_barrier_promise.RegisterAddress(it.rinfo()->pc());
@@ -89,6 +93,8 @@ InstructionStream::WriteBarrierPromise InstructionStream::RelocateFromDesc(
       it.rinfo()->apply(delta);
     }
   }
+  DCHECK(desc.embedded_objects.empty() ||
+         next_embedded_object == desc.embedded_objects.size());
   return write_barrier_promise;
 }
 
@@ -584,6 +584,10 @@ class SharedFunctionInfo
   // closest outer class scope.
   DECL_BOOLEAN_ACCESSORS(private_name_lookup_skips_outer_class)
 
+  // Indicates that the bytecode of the function was flushed by the GC. Cleared
+  // again when the function is recompiled.
+  DECL_BOOLEAN_ACCESSORS(bytecode_was_flushed)
+
   inline FunctionKind kind() const;
 
   int UniqueIdInScript() const;
@@ -4,6 +4,8 @@
 
 #include "src/parsing/literal-buffer.h"
 
+#include <algorithm>
+
 #include "src/base/strings.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate.h"
@@ -41,6 +43,23 @@ void LiteralBuffer::ExpandBuffer() {
   backing_store_ = new_store;
 }
 
+void LiteralBuffer::AddLatin1Chars(base::Vector<const uint16_t> chars) {
+  int byte_length = static_cast<int>(chars.size()) *
+                    (is_one_byte() ? kOneByteSize : base::kUC16Size);
+  while (position_ + byte_length > backing_store_.length()) ExpandBuffer();
+  if (is_one_byte()) {
+    DCHECK(std::all_of(chars.begin(), chars.end(), [](uint16_t c) {
+      return c <= unibrow::Latin1::kMaxChar;
+    }));
+    CopyChars(backing_store_.begin() + position_, chars.begin(),
+              chars.size());
+  } else {
+    CopyChars(reinterpret_cast<uint16_t*>(backing_store_.begin() + position_),
+              chars.begin(), chars.size());
+  }
+  position_ += byte_length;
+}
+
 void LiteralBuffer::ConvertToTwoByte() {
   DCHECK(is_one_byte());
   base::Vector<uint8_t> new_store;
@@ -38,6 +38,9 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of Latin-1 code units at once.
+  void AddLatin1Chars(base::Vector<const uint16_t> chars);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(base::Vector<const char> keyword) const {
@@ -0,0 +1,560 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/parsing/parallel-preparser.h"
+
+#include <algorithm>
+
+#include "include/v8-platform.h"
+#include "src/ast/ast-value-factory.h"
+#include "src/ast/ast.h"
+#include "src/ast/scopes.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/parsing/pending-compilation-error-handler.h"
+#include "src/parsing/preparse-data-impl.h"
+#include "src/parsing/preparse-data.h"
+#include "src/parsing/preparser.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "src/parsing/scanner.h"
+#include "src/tracing/trace-event.h"
+#include "src/utils/utils.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The number of tokens the skimmer scans between checks for yielding.
+constexpr int kSkimTokensPerYieldCheck = 4096;
+
+// What a '{' seen by the skimmer belongs to.
+enum class BraceKind : uint8_t {
+  // An object literal. Functions in it can still be top-level functions.
+  kObjectLiteral,
+  // The substitution of a template literal, i.e. the '{' of a '${'.
+  kTemplateSubstitution,
+  // A block, class body or function body.
+  kScope,
+};
+
+// Whether {token} can end an expression, in which case a following '/' is a
+// division and not the start of a regexp literal. A '}' ends an expression if
+// it closes an object literal, which the caller has to check.
+bool CanEndExpression(Token::Value token) {
+  switch (token) {
+    case Token::kRightParen:
+    case Token::kRightBracket:
+    case Token::kThis:
+    case Token::kSuper:
+    case Token::kNullLiteral:
+    case Token::kTrueLiteral:
+    case Token::kFalseLiteral:
+    case Token::kNumber:
+    case Token::kSmi:
+    case Token::kBigInt:
+    case Token::kString:
+    case Token::kTemplateTail:
+    case Token::kPrivateName:
+    case Token::kRegExpLiteral:
+    case Token::kInc:
+    case Token::kDec:
+      return true;
+    default:
+      return Token::IsAnyIdentifier(token);
+  }
+}
+
+// Whether a '{' after {previous} starts an object literal rather than a block
+// or a function or class body.
+bool StartsObjectLiteral(Token::Value previous, bool in_object_literal) {
+  switch (previous) {
+    case Token::kLeftParen:
+    case Token::kLeftBracket:
+    case Token::kConditional:
+    case Token::kEllipsis:
+    case Token::kNot:
+    case Token::kBitNot:
+    case Token::kTypeOf:
+    case Token::kVoid:
+    case Token::kDelete:
+      return true;
+    case Token::kColon:
+      // A property value, as opposed to a labelled block.
+      return in_object_literal;
+    case Token::kArrow:
+      return false;
+    default:
+      return Token::IsArrowOrAssignmentOp(previous) ||
+             Token::IsBinaryOp(previous) || Token::IsCompareOp(previous);
+  }
+}
+
+ZonePreparseData* CopyPreparseData(ZonePreparseData* data, Zone* zone) {
+  base::Vector<uint8_t> byte_data(data->byte_data()->data(),
+                                  data->byte_data()->size());
+  ZonePreparseData* copy = zone->New<ZonePreparseData>(
+      zone, &byte_data, data->children_length());
+  for (int i = 0; i < data->children_length(); i++) {
+    copy->set_child(i, CopyPreparseData(data->get_child(i), zone));
+  }
+  return copy;
+}
+
+}  // namespace
+
+struct ParallelPreparser::Candidate {
+  enum class State { kPending, kRunning, kDone, kFailed, kDropped };
+
+  bool Matches(FunctionKind other_kind,
+               FunctionSyntaxKind other_function_syntax_kind,
+               const AstRawString* other_name,
+               LanguageMode other_language_mode) const {
+    if (kind != other_kind ||
+        function_syntax_kind != other_function_syntax_kind ||
+        language_mode != other_language_mode) {
+      return false;
+    }
+    // Anonymous functions are preparsed with the empty string as their name.
+    if (other_name == nullptr) return name.empty();
+    return other_name->is_one_byte() == name_is_one_byte &&
+           static_cast<size_t>(other_name->byte_length()) == name.size() &&
+           std::equal(name.begin(), name.end(), other_name->raw_data());
+  }
+
+  int start_position;
+  FunctionKind kind;
+  FunctionSyntaxKind function_syntax_kind;
+  LanguageMode language_mode;
+  // The raw data of the function name; empty for anonymous functions.
+  std::vector<uint8_t> name;
+  bool name_is_one_byte;
+
+  // Protected by {ParallelPreparser::mutex_}.
+  State state = State::kPending;
+  // Valid once {state} is kDone. The preparse data lives in {result_zone}.
+  Result result;
+  std::unique_ptr<Zone> result_zone;
+};
+
+class ParallelPreparser::JobTask final : public v8::JobTask {
+ public:
+  explicit JobTask(ParallelPreparser* parallel_preparser)
+      : parallel_preparser_(parallel_preparser) {}
+
+  void Run(JobDelegate* delegate) final { parallel_preparser_->Run(delegate); }
+
+  size_t GetMaxConcurrency(size_t worker_count) const final {
+    return parallel_preparser_->GetMaxConcurrency();
+  }
+
+ private:
+  ParallelPreparser* const parallel_preparser_;
+};
+
+ParallelPreparser::ParallelPreparser(
+    const Utf16CharacterStream* stream, UnoptimizedCompileFlags flags,
+    LanguageMode language_mode, const AstStringConstants* ast_string_constants,
+    AccountingAllocator* allocator, size_t stack_size)
+    : stream_(stream->Clone()),
+      flags_(flags),
+      language_mode_(language_mode),
+      ast_string_constants_(ast_string_constants),
+      allocator_(allocator),
+      stack_size_(stack_size) {
+  DCHECK(stream->can_be_cloned_for_parallel_access());
+  job_handle_ = V8::GetCurrentPlatform()->CreateJob(
+      TaskPriority::kUserVisible, std::make_unique<JobTask>(this));
+  job_handle_->NotifyConcurrencyIncrease();
+}
+
+ParallelPreparser::~ParallelPreparser() {
+  if (job_handle_->IsValid()) job_handle_->Cancel();
+}
+
+void ParallelPreparser::JoinForTesting() { job_handle_->Join(); }
+
+size_t ParallelPreparser::GetMaxConcurrency() const {
+  size_t concurrency =
+      num_pending_candidates_.load(std::memory_order_relaxed) +
+      (skimming_.load(std::memory_order_relaxed) ? 1 : 0);
+  if (v8_flags.parallel_preparse_max_threads == 0) return concurrency;
+  return std::min(concurrency,
+                  static_cast<size_t>(v8_flags.parallel_preparse_max_threads));
+}
+
+// The state of the skimmer between runs, so that it can yield and later
+// resume where it stopped instead of starting over.
+struct ParallelPreparser::SkimState {
+  SkimState(const Utf16CharacterStream* original_stream,
+            UnoptimizedCompileFlags flags,
+            const AstStringConstants* ast_string_constants,
+            AccountingAllocator* allocator)
+      : zone(allocator, "parallel-preparser-skim-zone"),
+        ast_value_factory(&zone, ast_string_constants,
+                          ast_string_constants->hash_seed()),
+        stream(original_stream->Clone()),
+        scanner(stream.get(), flags) {}
+
+  Zone zone;
+  AstValueFactory ast_value_factory;
+  std::unique_ptr<Utf16CharacterStream> stream;
+  // Keeps the position of the skimmer, including the token it peeked at.
+  Scanner scanner;
+  LanguageMode language_mode;
+  std::vector<BraceKind> braces;
+  int num_scope_braces = 0;
+  Token::Value previous = Token::kSemicolon;
+  Token::Value before_previous = Token::kSemicolon;
+  // Whether {previous} is a '}' that closed an object literal.
+  bool previous_closed_object_literal = false;
+};
+
+void ParallelPreparser::Run(JobDelegate* delegate) {
+  if (skimming_.load(std::memory_order_relaxed) &&
+      !skim_claimed_.exchange(true, std::memory_order_acquire)) {
+    bool done = Skim(delegate);
+    if (done) {
+      skim_state_.reset();
+      skimming_.store(false, std::memory_order_relaxed);
+    }
+    // Lets another worker resume skimming if this one had to yield.
+    skim_claimed_.store(false, std::memory_order_release);
+    if (!done) return;
+  }
+  while (!delegate->ShouldYield()) {
+    Candidate* candidate = ClaimNextCandidate();
+    if (candidate == nullptr) return;
+    Preparse(candidate);
+  }
+}
+
+bool ParallelPreparser::Skim(JobDelegate* delegate) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.ParallelPreParseSkim");
+  if (!skim_state_) {
+    skim_state_ = std::make_unique<SkimState>(
+        stream_.get(), flags_, ast_string_constants_, allocator_);
+    Scanner& scanner = skim_state_->scanner;
+    skim_state_->stream->Seek(0);
+    scanner.Initialize();
+
+    // Look for a "use strict" in the directive prologue. Strings followed by
+    // anything but the end of the statement are expressions, and end the
+    // prologue.
+    skim_state_->language_mode = language_mode_;
+    while (scanner.peek() == Token::kString) {
+      bool use_strict = scanner.NextLiteralExactlyEquals("use strict");
+      scanner.Next();
+      skim_state_->previous = Token::kString;
+      Token::Value next = scanner.peek();
+      if (next != Token::kSemicolon && next != Token::kEos &&
+          !scanner.HasLineTerminatorBeforeNext()) {
+        break;
+      }
+      if (use_strict) skim_state_->language_mode = LanguageMode::kStrict;
+      if (next == Token::kSemicolon) {
+        scanner.Next();
+        skim_state_->previous = Token::kSemicolon;
+      }
+    }
+  }
+
+  SkimState* state = skim_state_.get();
+  Scanner& scanner = state->scanner;
+  std::vector<BraceKind>& braces = state->braces;
+  int& num_scope_braces = state->num_scope_braces;
+  Token::Value& previous = state->previous;
+  Token::Value& before_previous = state->before_previous;
+  bool& previous_closed_object_literal = state->previous_closed_object_literal;
+
+  int tokens_per_yield_check =
+      v8_flags.stress_parallel_preparse_yield ? 1 : kSkimTokensPerYieldCheck;
+  for (int i = 0;; i++) {
+    if (i > 0 && i % tokens_per_yield_check == 0 &&
+        (v8_flags.stress_parallel_preparse_yield || delegate->ShouldYield())) {
+      return false;
+    }
+
+    Token::Value token = scanner.peek();
+    if (token == Token::kEos || token == Token::kIllegal) return true;
+
+    bool previous_ends_expression =
+        previous == Token::kRightBrace ? previous_closed_object_literal
+                                       : CanEndExpression(previous);
+    if ((token == Token::kDiv || token == Token::kAssignDiv) &&
+        !previous_ends_expression) {
+      if (!scanner.ScanRegExpPattern()) return true;
+      if (!scanner.ScanRegExpFlags().has_value()) return true;
+      scanner.Next();
+      before_previous = previous;
+      previous = Token::kRegExpLiteral;
+      previous_closed_object_literal = false;
+      continue;
+    }
+
+    if (token == Token::kRightBrace && !braces.empty() &&
+        braces.back() == BraceKind::kTemplateSubstitution) {
+      braces.pop_back();
+      token = scanner.ScanTemplateContinuation();
+      scanner.Next();
+      if (token == Token::kTemplateSpan) {
+        braces.push_back(BraceKind::kTemplateSubstitution);
+      } else if (token != Token::kTemplateTail) {
+        return true;
+      }
+      before_previous = previous;
+      previous = token;
+      previous_closed_object_literal = false;
+      continue;
+    }
+
+    bool line_terminator_before = scanner.HasLineTerminatorBeforeNext();
+    scanner.Next();
+    bool closed_object_literal = false;
+    switch (token) {
+      case Token::kLeftBrace: {
+        bool in_object_literal =
+            !braces.empty() && braces.back() == BraceKind::kObjectLiteral;
+        if (StartsObjectLiteral(previous, in_object_literal)) {
+          braces.push_back(BraceKind::kObjectLiteral);
+        } else {
+          braces.push_back(BraceKind::kScope);
+          num_scope_braces++;
+        }
+        break;
+      }
+      case Token::kRightBrace:
+        if (braces.empty()) return true;
+        if (braces.back() == BraceKind::kScope) {
+          num_scope_braces--;
+        } else {
+          closed_object_literal = true;
+        }
+        braces.pop_back();
+        break;
+      case Token::kTemplateSpan:
+        braces.push_back(BraceKind::kTemplateSubstitution);
+        break;
+      case Token::kFunction: {
+        if (num_scope_braces != 0) break;
+        if (previous == Token::kPeriod || previous == Token::kQuestionPeriod) {
+          break;
+        }
+        bool is_async = previous == Token::kAsync && !line_terminator_before;
+        Token::Value before_function = is_async ? before_previous : previous;
+        bool is_generator = scanner.peek() == Token::kMul;
+        if (is_generator) scanner.Next();
+        auto candidate = std::make_unique<Candidate>();
+        candidate->name_is_one_byte = true;
+        bool has_name = Token::IsAnyIdentifier(scanner.peek());
+        if (has_name) {
+          scanner.Next();
+          const AstRawString* name =
+              scanner.CurrentSymbol(&state->ast_value_factory);
+          candidate->name.assign(name->raw_data(),
+                                 name->raw_data() + name->byte_length());
+          candidate->name_is_one_byte = name->is_one_byte();
+        }
+        if (scanner.peek() != Token::kLeftParen) break;
+
+        // A named function at the start of a statement is a declaration. This
+        // is a guess, which the main parser verifies.
+        bool at_statement_start =
+            braces.empty() &&
+            (before_function == Token::kSemicolon ||
+             before_function == Token::kRightBrace ||
+             before_function == Token::kColon ||
+             (line_terminator_before && CanEndExpression(before_function)));
+        candidate->start_position = scanner.peek_location().beg_pos;
+        candidate->kind =
+            is_async ? (is_generator ? FunctionKind::kAsyncGeneratorFunction
+                                     : FunctionKind::kAsyncFunction)
+                     : (is_generator ? FunctionKind::kGeneratorFunction
+                                     : FunctionKind::kNormalFunction);
+        candidate->function_syntax_kind =
+            !has_name ? FunctionSyntaxKind::kAnonymousExpression
+            : at_statement_start ? FunctionSyntaxKind::kDeclaration
+                                 : FunctionSyntaxKind::kNamedExpression;
+        candidate->language_mode = state->language_mode;
+        AddCandidate(std::move(candidate));
+        break;
+      }
+      default:
+        break;
+    }
+    before_previous = previous;
+    // After a function keyword, the tokens up to the '(' have been consumed.
+    previous = scanner.current_token();
+    previous_closed_object_literal = closed_object_literal;
+  }
+}
+
+void ParallelPreparser::AddCandidate(std::unique_ptr<Candidate> candidate) {
+  // The main parser is already past this function.
+  if (candidate->start_position <
+      main_position_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  {
+    base::MutexGuard guard(&mutex_);
+    candidates_by_position_.emplace(candidate->start_position,
+                                    candidate.get());
+    candidates_.push_back(std::move(candidate));
+  }
+  num_pending_candidates_.fetch_add(1, std::memory_order_relaxed);
+  job_handle_->NotifyConcurrencyIncrease();
+}
+
+ParallelPreparser::Candidate* ParallelPreparser::ClaimNextCandidate() {
+  base::MutexGuard guard(&mutex_);
+  int main_position = main_position_.load(std::memory_order_relaxed);
+  while (next_candidate_ < candidates_.size()) {
+    Candidate* candidate = candidates_[next_candidate_++].get();
+    if (candidate->state != Candidate::State::kPending) continue;
+    num_pending_candidates_.fetch_sub(1, std::memory_order_relaxed);
+    if (candidate->start_position < main_position) {
+      candidate->state = Candidate::State::kDropped;
+      continue;
+    }
+    candidate->state = Candidate::State::kRunning;
+    return candidate;
+  }
+  return nullptr;
+}
+
+void ParallelPreparser::Preparse(Candidate* candidate) {
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.ParallelPreParse");
+  Zone zone(allocator_, "parallel-preparser-zone");
+  AstValueFactory ast_value_factory(&zone, ast_string_constants_,
+                                    ast_string_constants_->hash_seed());
+  std::unique_ptr<Utf16CharacterStream> stream = stream_->Clone();
+  stream->Seek(candidate->start_position);
+  Scanner scanner(stream.get(), flags_);
+  scanner.Initialize();
+  // Like the main parser, the preparser expects the '(' to be consumed.
+  if (scanner.Next() != Token::kLeftParen ||
+      scanner.location().beg_pos != candidate->start_position) {
+    return Finish(candidate, false);
+  }
+
+  PendingCompilationErrorHandler pending_error_handler;
+  PreParser preparser(&zone, &scanner,
+                      GetCurrentStackPosition() - stack_size_ * KB,
+                      &ast_value_factory, &pending_error_handler, nullptr,
+                      nullptr, flags_, false);
+
+  // Set up the same scopes as the main parser would for a top-level function.
+  DeclarationScope* script_scope =
+      zone.New<DeclarationScope>(&zone, &ast_value_factory);
+  DeclarationScope* function_scope = zone.New<DeclarationScope>(
+      &zone, script_scope, FUNCTION_SCOPE, candidate->kind);
+  function_scope->DeclareDefaultFunctionVariables(&ast_value_factory);
+  function_scope->SetLanguageMode(candidate->language_mode);
+  function_scope->set_start_position(candidate->start_position);
+
+  const AstRawString* function_name = ast_value_factory.empty_string();
+  if (candidate->name_is_one_byte) {
+    if (!candidate->name.empty()) {
+      function_name = ast_value_factory.GetOneByteString(
+          base::Vector<const uint8_t>(candidate->name.data(),
+                                      candidate->name.size()));
+    }
+  } else {
+    function_name =
+        ast_value_factory.GetTwoByteString(base::Vector<const uint16_t>(
+            reinterpret_cast<const uint16_t*>(candidate->name.data()),
+            candidate->name.size() / sizeof(uint16_t)));
+  }
+
+  Result& result = candidate->result;
+  std::fill(std::begin(result.use_counts), std::end(result.use_counts), 0);
+  ProducedPreparseData* produced_preparse_data = nullptr;
+  PreParser::PreParseResult preparse_result = preparser.PreParseFunction(
+      function_name, candidate->kind, candidate->function_syntax_kind,
+      function_scope, result.use_counts, &produced_preparse_data);
+
+  // Leave anything that the main parser would have to report (errors,
+  // warnings, or things it collects from its scanner) to the main parser, as
+  // well as functions calling eval, which the main parser has to record on the
+  // script scope.
+  if (preparse_result != PreParser::kPreParseSuccess ||
+      function_scope->inner_scope_calls_eval() ||
+      scanner.has_parser_error() || pending_error_handler.has_pending_error() ||
+      pending_error_handler.has_pending_warnings() ||
+      pending_error_handler.has_error_unidentifiable_by_preparser() ||
+      scanner.FoundHtmlComment() || scanner.SawAnyMagicComment()) {
+    return Finish(candidate, false);
+  }
+
+  PreParserLogger* logger = preparser.logger();
+  result.end_position = logger->end();
+  result.num_parameters = logger->num_parameters();
+  result.function_length = logger->function_length();
+  result.num_inner_infos = logger->num_inner_infos();
+  result.language_mode = function_scope->language_mode();
+  result.allow_eval_cache = preparser.allow_eval_cache();
+  result.preparse_data = nullptr;
+  if (produced_preparse_data != nullptr) {
+    AstNodeFactory ast_node_factory(&ast_value_factory, &zone);
+    std::vector<uint8_t> preparse_data_buffer;
+    function_scope->AnalyzeTopLevelFunctionOffThread(
+        &ast_node_factory, &preparse_data_buffer, &zone);
+    candidate->result_zone =
+        std::make_unique<Zone>(allocator_, "parallel-preparser-result-zone");
+    result.preparse_data =
+        produced_preparse_data->Serialize(candidate->result_zone.get());
+  }
+  Finish(candidate, true);
+}
+
+void ParallelPreparser::Finish(Candidate* candidate, bool success) {
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(Candidate::State::kRunning, candidate->state);
+  candidate->state =
+      success ? Candidate::State::kDone : Candidate::State::kFailed;
+  if (!success) candidate->result_zone.reset();
+  candidate_done_.NotifyAll();
+}
+
+bool ParallelPreparser::TakeResult(int start_position, FunctionKind kind,
+                                   FunctionSyntaxKind function_syntax_kind,
+                                   const AstRawString* function_name,
+                                   LanguageMode language_mode, Zone* zone,
+                                   Result* result) {
+  if (start_position > main_position_.load(std::memory_order_relaxed)) {
+    main_position_.store(start_position, std::memory_order_relaxed);
+  }
+
+  base::MutexGuard guard(&mutex_);
+  auto it = candidates_by_position_.find(start_position);
+  if (it == candidates_by_position_.end()) return false;
+  Candidate* candidate = it->second;
+  candidates_by_position_.erase(it);
+
+  bool matches = candidate->Matches(kind, function_syntax_kind, function_name,
+                                    language_mode);
+  if (candidate->state == Candidate::State::kPending) {
+    // Preparsing it ourselves is at least as fast as waiting for a worker.
+    candidate->state = Candidate::State::kDropped;
+    num_pending_candidates_.fetch_sub(1, std::memory_order_relaxed);
+    return false;
+  }
+  if (!matches) return false;
+  while (candidate->state == Candidate::State::kRunning) {
+    candidate_done_.Wait(&mutex_);
+  }
+  if (candidate->state != Candidate::State::kDone) return false;
+
+  *result = candidate->result;
+  if (result->preparse_data != nullptr) {
+    result->preparse_data = CopyPreparseData(result->preparse_data, zone);
+  }
+  candidate->result_zone.reset();
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,142 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_PARALLEL_PREPARSER_H_
+#define V8_PARSING_PARALLEL_PREPARSER_H_
+
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+#include "src/objects/function-kind.h"
+#include "src/objects/function-syntax-kind.h"
+#include "src/parsing/parse-info.h"
+
+namespace v8 {
+
+class JobDelegate;
+class JobHandle;
+
+namespace internal {
+
+class AccountingAllocator;
+class AstRawString;
+class AstStringConstants;
+class Utf16CharacterStream;
+class Zone;
+class ZonePreparseData;
+
+// Preparses the lazy top-level functions of a classic script on worker
+// threads, while the main parser is still busy with the code in front of them.
+//
+// A skimming task tokenizes a clone of the character stream ahead of the
+// parser to find candidate function literals that are not nested in any
+// function, block or class body. Worker tasks then preparse each candidate
+// with their own PreParser, Scanner and AstValueFactory; nothing but the
+// immutable AstStringConstants is shared with the main parser.
+//
+// Candidates are only guesses (e.g. the skimmer tells regexp literals from
+// divisions by looking at the previous token), so the main parser only takes
+// the result for a function it would preparse itself, whose scope is a direct
+// child of the script scope, and which has the same start position, kind,
+// syntax kind, name and language mode as the candidate. The preparser ignores
+// all scopes above the function scope of such a function, so the result is
+// the same as if the main parser had preparsed it. Whenever a result isn't
+// available, including on errors, the main parser preparses the function
+// itself, so the parse doesn't depend on thread timing.
+class V8_EXPORT_PRIVATE ParallelPreparser final {
+ public:
+  // The outcome of preparsing a function, in the form the main parser would
+  // have gotten it from its own PreParser.
+  struct Result {
+    int end_position;
+    int num_parameters;
+    int function_length;
+    int num_inner_infos;
+    LanguageMode language_mode;
+    bool allow_eval_cache;
+    // Allocated in the zone passed to TakeResult, or nullptr if the function
+    // has no inner functions with data.
+    ZonePreparseData* preparse_data;
+    int use_counts[v8::Isolate::kUseCounterFeatureCount];
+  };
+
+  // {stream} must be safe to read concurrently with the main parser, see
+  // Parser::MaybeStartParallelPreparse. It is cloned, and not used after the
+  // constructor returns. {language_mode} is the language mode of the script
+  // before any directives.
+  ParallelPreparser(const Utf16CharacterStream* stream,
+                    UnoptimizedCompileFlags flags, LanguageMode language_mode,
+                    const AstStringConstants* ast_string_constants,
+                    AccountingAllocator* allocator, size_t stack_size);
+  ~ParallelPreparser();
+  ParallelPreparser(const ParallelPreparser&) = delete;
+  ParallelPreparser& operator=(const ParallelPreparser&) = delete;
+
+  // Returns true and fills in {result} if a worker preparsed the function at
+  // {start_position} (the position of its opening parenthesis) with exactly
+  // the given properties, waiting for the worker if it is still busy with it.
+  // Otherwise, the candidate is dropped and the caller has to preparse the
+  // function itself. Functions must be requested in source order.
+  bool TakeResult(int start_position, FunctionKind kind,
+                  FunctionSyntaxKind function_syntax_kind,
+                  const AstRawString* function_name,
+                  LanguageMode language_mode, Zone* zone, Result* result);
+
+  // Blocks until the whole script has been skimmed and all candidates have
+  // been preparsed.
+  void JoinForTesting();
+
+ private:
+  class JobTask;
+  struct Candidate;
+  struct SkimState;
+
+  void Run(JobDelegate* delegate);
+  size_t GetMaxConcurrency() const;
+
+  // Returns false if it had to yield before reaching the end of the script,
+  // in which case the next call resumes from where it stopped.
+  bool Skim(JobDelegate* delegate);
+  void AddCandidate(std::unique_ptr<Candidate> candidate);
+  Candidate* ClaimNextCandidate();
+  void Preparse(Candidate* candidate);
+  void Finish(Candidate* candidate, bool success);
+
+  std::unique_ptr<Utf16CharacterStream> stream_;
+  const UnoptimizedCompileFlags flags_;
+  const LanguageMode language_mode_;
+  const AstStringConstants* const ast_string_constants_;
+  AccountingAllocator* const allocator_;
+  const size_t stack_size_;
+
+  // Protects the candidate list and the results, and is used together with
+  // {candidate_done_} to wait for a candidate a worker is busy with.
+  base::Mutex mutex_;
+  base::ConditionVariable candidate_done_;
+  std::vector<std::unique_ptr<Candidate>> candidates_;
+  std::unordered_map<int, Candidate*> candidates_by_position_;
+  size_t next_candidate_ = 0;
+
+  // Set while a worker is skimming. Only that worker accesses {skim_state_}.
+  std::atomic<bool> skim_claimed_{false};
+  std::unique_ptr<SkimState> skim_state_;
+  std::atomic<bool> skimming_{true};
+  std::atomic<size_t> num_pending_candidates_{0};
+  // Start position of the last function requested by the main parser.
+  // Candidates in front of it will never be requested.
+  std::atomic<int> main_position_{0};
+
+  std::unique_ptr<JobHandle> job_handle_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PARSING_PARALLEL_PREPARSER_H_
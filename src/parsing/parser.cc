@@ -766,7 +766,9 @@ FunctionLiteral* Parser::DoParseProgram(Isolate* isolate, ParseInfo* info) {
       // Don't count the mode in the use counters--give the program a chance
       // to enable script-wide strict mode below.
       this->scope()->SetLanguageMode(info->language_mode());
+      MaybeStartParallelPreparse(info);
       ParseStatementList(&body, Token::kEos);
+      parallel_preparser_.reset();
     }
 
     // The parser will peek but not consume kEos.  Our scope logically goes all
@@ -2892,6 +2894,13 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
     return true;
   }
 
+  if (SkipFunctionPreparsedInParallel(function_name, kind, function_syntax_kind,
+                                      function_scope, num_parameters,
+                                      function_length,
+                                      produced_preparse_data)) {
+    return true;
+  }
+
   Scanner::BookmarkScope bookmark(scanner());
   bookmark.Set(function_scope->start_position());
 
@@ -2955,6 +2964,77 @@ bool Parser::SkipFunction(const AstRawString* function_name, FunctionKind kind,
   return true;
 }
 
+void Parser::MaybeStartParallelPreparse(ParseInfo* info) {
+  DCHECK_NULL(parallel_preparser_);
+  if (!v8_flags.parallel_preparse || !parse_lazily()) return;
+  if (!flags().is_toplevel() || flags().is_eval() || flags().is_module() ||
+      flags().is_repl_mode() || consumed_preparse_data_ != nullptr) {
+    return;
+  }
+  // The workers read the source concurrently with the main parser, which rules
+  // out streamed sources (their chunk list grows while parsing) and sources
+  // that live on the V8 heap.
+  if (info->is_streaming_compilation() ||
+      !scanner()->stream()->can_be_cloned_for_parallel_access()) {
+    return;
+  }
+  parallel_preparser_ = std::make_unique<ParallelPreparser>(
+      scanner()->stream(), flags(), info->language_mode(),
+      info->ast_string_constants(), main_zone()->allocator(),
+      v8_flags.stack_size);
+}
+
+bool Parser::SkipFunctionPreparsedInParallel(
+    const AstRawString* function_name, FunctionKind kind,
+    FunctionSyntaxKind function_syntax_kind, DeclarationScope* function_scope,
+    int* num_parameters, int* function_length,
+    ProducedPreparseData** produced_preparse_data) {
+  // Workers only preparse functions whose scope is a direct child of the
+  // script scope, which makes their result independent of the outer scopes.
+  if (!parallel_preparser_ || IsArrowFunction(kind) ||
+      !function_scope->outer_scope()->is_script_scope() ||
+      MaybeParsingArrowhead() || stack_overflow()) {
+    return false;
+  }
+
+  ParallelPreparser::Result result;
+  if (!parallel_preparser_->TakeResult(
+          function_scope->start_position(), kind, function_syntax_kind,
+          function_name, function_scope->language_mode(), main_zone(),
+          &result)) {
+    return false;
+  }
+
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.ParallelPreParseApply");
+  if (!result.allow_eval_cache) {
+    set_allow_eval_cache(false);
+    if (reusable_preparser_ != nullptr) {
+      reusable_preparser_->set_allow_eval_cache(false);
+    }
+  }
+  function_scope->set_end_position(result.end_position);
+  scanner()->SeekForward(result.end_position - 1);
+  Expect(Token::kRightBrace);
+  total_preparse_skipped_ +=
+      function_scope->end_position() - function_scope->start_position();
+  *num_parameters = result.num_parameters;
+  *function_length = result.function_length;
+  if (result.preparse_data != nullptr) {
+    *produced_preparse_data =
+        ProducedPreparseData::For(result.preparse_data, main_zone());
+  }
+  for (int feature = 0; feature < v8::Isolate::kUseCounterFeatureCount;
+       ++feature) {
+    use_counts_[feature] += result.use_counts[feature];
+  }
+  // The worker already counted the language mode in {use_counts}.
+  function_scope->SetLanguageMode(result.language_mode);
+  SkipInfos(result.num_inner_infos);
+  function_scope->ResetAfterPreparsing(ast_value_factory_, false);
+  return true;
+}
+
 Block* Parser::BuildParameterInitializationBlock(
     const ParserFormalParameters& parameters) {
   DCHECK(!parameters.is_simple);
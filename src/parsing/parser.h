@@ -17,6 +17,7 @@
 #include "src/base/threaded-list.h"
 #include "src/common/globals.h"
 #include "src/parsing/import-attributes.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parser-base.h"
 #include "src/parsing/parsing.h"
@@ -472,6 +473,18 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
                     int* function_length,
                     ProducedPreparseData** produced_preparsed_scope_data);
 
+  // Starts preparsing the top-level functions of the script on worker threads
+  // if the script qualifies, see ParallelPreparser.
+  void MaybeStartParallelPreparse(ParseInfo* info);
+  // Applies the result of a worker preparsing the top-level function with
+  // {function_scope}, if there is one. Returns true if the function has been
+  // skipped this way.
+  bool SkipFunctionPreparsedInParallel(
+      const AstRawString* function_name, FunctionKind kind,
+      FunctionSyntaxKind function_syntax_kind, DeclarationScope* function_scope,
+      int* num_parameters, int* function_length,
+      ProducedPreparseData** produced_preparsed_scope_data);
+
   Block* BuildParameterInitializationBlock(
       const ParserFormalParameters& parameters);
 
@@ -1135,6 +1148,7 @@ class V8_EXPORT_PRIVATE Parser : public NON_EXPORTED_BASE(ParserBase<Parser>) {
   bool temp_zoned_;
   ConsumedPreparseData* consumed_preparse_data_;
   std::vector<uint8_t> preparse_data_buffer_;
+  std::unique_ptr<ParallelPreparser> parallel_preparser_;
 
   // If not kNoSourcePosition, indicates that the first function literal
   // encountered is a dynamic function, see CreateDynamicFunction(). This field
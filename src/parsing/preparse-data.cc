@@ -314,10 +314,17 @@ bool PreparseDataBuilder::SaveDataForSkippableFunction(
 
 void PreparseDataBuilder::SaveScopeAllocationData(DeclarationScope* scope,
                                                   Parser* parser) {
+  SaveScopeAllocationData(scope, parser->preparse_data_buffer(),
+                          parser->factory()->zone());
+}
+
+void PreparseDataBuilder::SaveScopeAllocationData(
+    DeclarationScope* scope, std::vector<uint8_t>* preparse_data_buffer,
+    Zone* zone) {
   if (!has_data_) return;
   DCHECK(HasInnerFunctions());
 
-  byte_data_.Start(parser->preparse_data_buffer());
+  byte_data_.Start(preparse_data_buffer);
 
 #ifdef DEBUG
   // Reserve Uint32 for scope_data_start debug info.
@@ -350,7 +357,7 @@ void PreparseDataBuilder::SaveScopeAllocationData(DeclarationScope* scope,
 
   if (ScopeNeedsData(scope)) SaveDataForScope(scope);
   }
-  byte_data_.Finalize(parser->factory()->zone());
+  byte_data_.Finalize(zone);
 }
 
 void PreparseDataBuilder::SaveDataForScope(Scope* scope) {
@@ -180,6 +180,11 @@ class V8_EXPORT_PRIVATE PreparseDataBuilder : public ZoneObject,
   // Saves the information needed for allocating the Scope's (and its
   // subscopes') variables.
   void SaveScopeAllocationData(DeclarationScope* scope, Parser* parser);
+  // As above, but uses the given scratch buffer and zone instead of the
+  // parser's. Used when preparsing off the main parser's thread.
+  void SaveScopeAllocationData(DeclarationScope* scope,
+                               std::vector<uint8_t>* preparse_data_buffer,
+                               Zone* zone);
 
   // In some cases, PreParser cannot produce the same Scope structure as
   // Parser. If it happens, we're unable to produce the data that would enable
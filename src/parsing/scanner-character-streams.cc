@@ -558,14 +558,33 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   // A chunk in the list of chunks, containing:
   // - The chunk data (data pointer and length), and
   // - the position at the first byte of the chunk.
+  // - whether the chunk consists of ASCII only and starts at a character
+  //   boundary, so that its characters map 1:1 to its bytes.
   struct Chunk {
     Chunk(const uint8_t* data, size_t length, StreamPosition start)
-        : data(data), length(length), start(start) {}
+        : data(data),
+          length(length),
+          start(start),
+          is_ascii(start.incomplete_char == 0 &&
+                   start.state == unibrow::Utf8::State::kAccept &&
+                   IsAscii(data, length)) {}
     std::unique_ptr<const uint8_t[]> data;
     size_t length;
     StreamPosition start;
+    bool is_ascii;
   };
 
+  static bool IsAscii(const uint8_t* data, size_t length) {
+    while (length > 0) {
+      int block = static_cast<int>(
+          std::min(length, static_cast<size_t>(kMaxInt)));
+      if (NonAsciiStart(data, block) != block) return false;
+      data += block;
+      length -= block;
+    }
+    return true;
+  }
+
   Utf8ExternalStreamingStream(const Utf8ExternalStreamingStream& source_stream)
       V8_NOEXCEPT : chunks_(source_stream.chunks_),
                     current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
@@ -597,6 +616,17 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   const Chunk& chunk = GetChunk(current_.chunk_no);
   DCHECK(current_.pos.bytes >= chunk.start.bytes);
 
+  // In ASCII chunks, characters can be skipped without decoding them.
+  if (chunk.is_ascii) {
+    size_t chunk_end = chunk.start.bytes + chunk.length;
+    size_t skip =
+        std::min(position - current_.pos.chars, chunk_end - current_.pos.bytes);
+    current_.pos.bytes += skip;
+    current_.pos.chars += skip;
+    current_.chunk_no += (current_.pos.bytes == chunk_end);
+    return current_.pos.chars == position;
+  }
+
   unibrow::Utf8::State state = chunk.start.state;
   uint32_t incomplete_char = chunk.start.incomplete_char;
   size_t it = current_.pos.bytes - chunk.start.bytes;
@@ -776,26 +806,11 @@ void Utf8ExternalStreamingStream::SearchPosition(size_t position) {
 
   // Did we find the non-last chunk? Then our position must be within chunk_no.
   if (chunk_no + 1 < chunks_->size()) {
-    // Fancy-pants optimization for ASCII chunks within a utf-8 stream.
-    // (Many web sites declare utf-8 encoding, but use only (or almost only) the
-    //  ASCII subset for their JavaScript sources. We can exploit this, by
-    //  checking whether the # bytes in a chunk are equal to the # chars, and if
-    //  so avoid the expensive SkipToPosition.)
-    bool ascii_only_chunk =
-        GetChunk(chunk_no).start.incomplete_char == 0 &&
-        (GetChunk(chunk_no + 1).start.bytes - GetChunk(chunk_no).start.bytes) ==
-            (GetChunk(chunk_no + 1).start.chars -
-             GetChunk(chunk_no).start.chars);
-    if (ascii_only_chunk) {
-      size_t skip = position - GetChunk(chunk_no).start.chars;
-      current_ = {chunk_no,
-                  {GetChunk(chunk_no).start.bytes + skip,
-                   GetChunk(chunk_no).start.chars + skip, 0,
-                   unibrow::Utf8::State::kAccept}};
-    } else {
-      current_ = {chunk_no, GetChunk(chunk_no).start};
-      SkipToPosition(position);
-    }
+    // Many web sites declare utf-8 encoding, but use only (or almost only) the
+    // ASCII subset for their JavaScript sources. SkipToPosition doesn't need
+    // to decode ASCII chunks, making this cheap for them.
+    current_ = {chunk_no, GetChunk(chunk_no).start};
+    SkipToPosition(position);
 
     // Since position was within the chunk, SkipToPosition should have found
     // something.
@@ -6,6 +6,7 @@
 #define V8_PARSING_SCANNER_INL_H_
 
 #include "src/parsing/keywords-gen.h"
+#include "src/parsing/scanner-simd.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/utils/utils.h"
@@ -277,25 +278,31 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
-      });
+      AdvanceUntil(
+          [this, &scan_flags](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              // A non-ascii character means we need to drop through to the
+              // slow path.
+              // TODO(leszeks): This would be most efficient as a goto to the
+              // slow path, check codegen and maybe use a bool instead.
+              scan_flags |=
+                  static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+              return true;
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            scan_flags |= char_flags;
+            if (TerminatesLiteral(char_flags)) {
+              return true;
+            } else {
+              AddLiteralChar(static_cast<char>(c0));
+              return false;
+            }
+          },
+          scanner_simd::FindNonAsciiIdentifierPart,
+          [this, &scan_flags](base::Vector<const uint16_t> chars) {
+            for (uint16_t c : chars) scan_flags |= character_scan_flags[c];
+            AddLiteralChars(chars);
+          });
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::kIdentifier;
@@ -331,17 +338,19 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
 
   // Advance as long as character is a WhiteSpace or LineTerminator.
   base::uc32 hint = ' ';
-  AdvanceUntil([this, &hint](base::uc32 c0) {
-    if (V8_LIKELY(c0 == hint)) return false;
-    if (IsWhiteSpaceOrLineTerminator(c0)) {
-      if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
-        next().after_line_terminator = true;
-      }
-      hint = c0;
-      return false;
-    }
-    return true;
-  });
+  AdvanceUntil(
+      [this, &hint](base::uc32 c0) {
+        if (V8_LIKELY(c0 == hint)) return false;
+        if (IsWhiteSpaceOrLineTerminator(c0)) {
+          if (!next().after_line_terminator && unibrow::IsLineTerminator(c0)) {
+            next().after_line_terminator = true;
+          }
+          hint = c0;
+          return false;
+        }
+        return true;
+      },
+      scanner_simd::FindNonBlank, [](base::Vector<const uint16_t>) {});
 
   return Token::kWhitespace;
 }
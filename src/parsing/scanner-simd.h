@@ -0,0 +1,217 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PARSING_SCANNER_SIMD_H_
+#define V8_PARSING_SCANNER_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "src/base/bits.h"
+#include "src/base/vector.h"
+
+// x64 always has SSE2, and ia32 without SSE2 is not supported by V8. Only use
+// Neon on 64-bit ARM, where it is guaranteed to be available.
+#if defined(__SSE2__) || \
+    (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define V8_SCANNER_SIMD_SSE2 1
+#include <emmintrin.h>
+#elif defined(V8_HOST_ARCH_ARM64) && \
+    (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define V8_SCANNER_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace v8::internal::scanner_simd {
+
+// Vectorized searches over the UTF-16 buffer of a Utf16CharacterStream. The
+// scanner uses them to skip over runs of code units that need no
+// per-character processing, like the bodies of comments, strings and
+// template literals, and only falls back to its character-by-character loop
+// at the code units they stop at.
+//
+// Each search returns the index of the first code unit in {chars} that is in
+// the given class, or chars.size() if there is none. Code units that are not
+// in the class are guaranteed to need no special handling, but the class may
+// include code units that turn out to be ordinary (e.g. non-ASCII ones), so
+// that the vector code only needs a few compares.
+
+constexpr uint16_t kMaxAscii = 0x7F;
+constexpr uint16_t kMaxLatin1 = 0xFF;
+
+#if defined(V8_SCANNER_SIMD_SSE2)
+
+using Vector = __m128i;
+constexpr size_t kLanes = sizeof(Vector) / sizeof(uint16_t);
+
+V8_INLINE Vector Load(const uint16_t* chars) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+}
+V8_INLINE Vector Equal(Vector chars, uint16_t c) {
+  return _mm_cmpeq_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(c)));
+}
+V8_INLINE Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+V8_INLINE Vector Not(Vector a) {
+  return _mm_xor_si128(a, _mm_set1_epi32(-1));
+}
+// Unsigned {chars} > {limit}, using a saturating subtraction since SSE2 only
+// has signed 16-bit compares.
+V8_INLINE Vector GreaterThan(Vector chars, uint16_t limit) {
+  Vector excess =
+      _mm_subs_epu16(chars, _mm_set1_epi16(static_cast<int16_t>(limit)));
+  return Not(_mm_cmpeq_epi16(excess, _mm_setzero_si128()));
+}
+// Unsigned {from} <= {chars} <= {to}.
+V8_INLINE Vector InRange(Vector chars, uint16_t from, uint16_t to) {
+  Vector offset =
+      _mm_sub_epi16(chars, _mm_set1_epi16(static_cast<int16_t>(from)));
+  Vector excess = _mm_subs_epu16(
+      offset, _mm_set1_epi16(static_cast<int16_t>(to - from)));
+  return _mm_cmpeq_epi16(excess, _mm_setzero_si128());
+}
+// Returns the index of the first lane set in {mask}, or kLanes if none is.
+V8_INLINE size_t FirstSetLane(Vector mask) {
+  // Every 16-bit lane contributes two bits.
+  uint32_t bits = static_cast<uint32_t>(_mm_movemask_epi8(mask));
+  if (bits == 0) return kLanes;
+  return base::bits::CountTrailingZerosNonZero(bits) / 2;
+}
+
+#elif defined(V8_SCANNER_SIMD_NEON)
+
+using Vector = uint16x8_t;
+constexpr size_t kLanes = sizeof(Vector) / sizeof(uint16_t);
+
+V8_INLINE Vector Load(const uint16_t* chars) { return vld1q_u16(chars); }
+V8_INLINE Vector Equal(Vector chars, uint16_t c) {
+  return vceqq_u16(chars, vdupq_n_u16(c));
+}
+V8_INLINE Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+V8_INLINE Vector Not(Vector a) { return vmvnq_u16(a); }
+V8_INLINE Vector GreaterThan(Vector chars, uint16_t limit) {
+  return vcgtq_u16(chars, vdupq_n_u16(limit));
+}
+V8_INLINE Vector InRange(Vector chars, uint16_t from, uint16_t to) {
+  return vcleq_u16(vsubq_u16(chars, vdupq_n_u16(from)),
+                   vdupq_n_u16(to - from));
+}
+V8_INLINE size_t FirstSetLane(Vector mask) {
+  // Narrowing every 16-bit lane to 8 bits gives a 64-bit mask with one byte
+  // per lane.
+  uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(mask)), 0);
+  if (bits == 0) return kLanes;
+  return base::bits::CountTrailingZerosNonZero(bits) / 8;
+}
+
+#endif
+
+// Returns the index of the first code unit for which {in_class} holds. The
+// vector and scalar predicates have to agree.
+template <typename VectorPredicate, typename ScalarPredicate>
+V8_INLINE size_t FindFirst(base::Vector<const uint16_t> chars,
+                           VectorPredicate vector_in_class,
+                           ScalarPredicate in_class) {
+  size_t i = 0;
+#if defined(V8_SCANNER_SIMD_SSE2) || defined(V8_SCANNER_SIMD_NEON)
+  for (; i + kLanes <= chars.size(); i += kLanes) {
+    size_t lane = FirstSetLane(vector_in_class(Load(chars.begin() + i)));
+    if (lane != kLanes) return i + lane;
+  }
+#endif
+  for (; i < chars.size(); i++) {
+    if (in_class(chars[i])) return i;
+  }
+  return chars.size();
+}
+
+#if defined(V8_SCANNER_SIMD_SSE2) || defined(V8_SCANNER_SIMD_NEON)
+#define VECTOR_PREDICATE(...) [](Vector v) { return __VA_ARGS__; }
+#else
+#define VECTOR_PREDICATE(...) nullptr
+#endif
+
+// Whitespace: anything but spaces and tabs, which make up the bulk of
+// indentation.
+V8_INLINE size_t FindNonBlank(base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars, VECTOR_PREDICATE(Not(Or(Equal(v, ' '), Equal(v, '\t')))),
+      [](uint16_t c) { return c != ' ' && c != '\t'; });
+}
+
+// Single-line comments: CR and LF, and non-ASCII code units since they
+// include U+2028 and U+2029.
+V8_INLINE size_t FindLineTerminatorOrNonAscii(
+    base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars,
+      VECTOR_PREDICATE(
+          Or(Or(Equal(v, '\n'), Equal(v, '\r')), GreaterThan(v, kMaxAscii))),
+      [](uint16_t c) { return c == '\n' || c == '\r' || c > kMaxAscii; });
+}
+
+// Multi-line comments before their first line terminator: like
+// FindLineTerminatorOrNonAscii, but also stops at the '*' of a potential end.
+V8_INLINE size_t FindCommentSpecial(base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars,
+      VECTOR_PREDICATE(Or(Or(Equal(v, '*'), Equal(v, '\n')),
+                          Or(Equal(v, '\r'), GreaterThan(v, kMaxAscii)))),
+      [](uint16_t c) {
+        return c == '*' || c == '\n' || c == '\r' || c > kMaxAscii;
+      });
+}
+
+// Multi-line comments after their first line terminator.
+V8_INLINE size_t FindAsterisk(base::Vector<const uint16_t> chars) {
+  return FindFirst(chars, VECTOR_PREDICATE(Equal(v, '*')),
+                   [](uint16_t c) { return c == '*'; });
+}
+
+// String literals: quotes, escapes and CR and LF. Non-Latin-1 code units are
+// included so that the skipped ones can be added to a one-byte literal.
+V8_INLINE size_t FindStringSpecial(base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars,
+      VECTOR_PREDICATE(Or(Or(Or(Equal(v, '\''), Equal(v, '"')),
+                             Or(Equal(v, '\\'), Equal(v, '\n'))),
+                          Or(Equal(v, '\r'), GreaterThan(v, kMaxLatin1)))),
+      [](uint16_t c) {
+        return c == '\'' || c == '"' || c == '\\' || c == '\n' || c == '\r' ||
+               c > kMaxLatin1;
+      });
+}
+
+// Template literal spans: the closing backtick, substitutions, escapes, and CR
+// (which is normalized). As for strings, non-Latin-1 code units are included.
+V8_INLINE size_t FindTemplateSpecial(base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars,
+      VECTOR_PREDICATE(Or(Or(Or(Equal(v, '`'), Equal(v, '$')),
+                             Or(Equal(v, '\\'), Equal(v, '\r'))),
+                          GreaterThan(v, kMaxLatin1))),
+      [](uint16_t c) {
+        return c == '`' || c == '$' || c == '\\' || c == '\r' ||
+               c > kMaxLatin1;
+      });
+}
+
+// Identifiers: anything but ASCII letters, digits, '_' and '$'.
+V8_INLINE size_t FindNonAsciiIdentifierPart(
+    base::Vector<const uint16_t> chars) {
+  return FindFirst(
+      chars,
+      VECTOR_PREDICATE(Not(Or(Or(InRange(v, 'a', 'z'), InRange(v, 'A', 'Z')),
+                              Or(InRange(v, '0', '9'),
+                                 Or(Equal(v, '_'), Equal(v, '$')))))),
+      [](uint16_t c) {
+        return !(('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') ||
+                 ('0' <= c && c <= '9') || c == '_' || c == '$');
+      });
+}
+
+#undef VECTOR_PREDICATE
+
+}  // namespace v8::internal::scanner_simd
+
+#endif  // V8_PARSING_SCANNER_SIMD_H_
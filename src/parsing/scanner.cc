@@ -236,7 +236,9 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); },
+               scanner_simd::FindLineTerminatorOrNonAscii,
+               [](base::Vector<const uint16_t>) {});
 
   return Token::kWhitespace;
 }
@@ -315,13 +317,15 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntil(
+          [](base::uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          },
+          scanner_simd::FindCommentSpecial, [](base::Vector<const uint16_t>) {});
 
       while (c0_ == '*') {
         Advance();
@@ -340,7 +344,9 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; },
+                 scanner_simd::FindAsterisk,
+                 [](base::Vector<const uint16_t>) {});
 
     while (c0_ == '*') {
       Advance();
@@ -494,19 +500,22 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntil(
+        [this](base::uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        },
+        scanner_simd::FindStringSpecial,
+        [this](base::Vector<const uint16_t> chars) { AddLiteralChars(chars); });
 
     while (c0_ == '\\') {
       Advance();
@@ -608,6 +617,24 @@ Token::Value Scanner::ScanTemplateSpan() {
     } else if (c == kEndOfInput) {
       // Unterminated template literal
       break;
+    } else if (c != '\r' && c <= unibrow::Latin1::kMaxChar) {
+      // Consume c together with the run of ordinary code units after it.
+      AddRawLiteralChar(c);
+      AddLiteralChar(c);
+      AdvanceUntil(
+          [this](base::uc32 c0) {
+            if (c0 == '`' || c0 == '$' || c0 == '\\' || c0 == '\r' ||
+                c0 > unibrow::Latin1::kMaxChar) {
+              return true;
+            }
+            AddRawLiteralChar(c0);
+            AddLiteralChar(c0);
+            return false;
+          },
+          scanner_simd::FindTemplateSpecial,
+          [this](base::Vector<const uint16_t> chars) {
+            AddLiteralChars<capture_raw>(chars);
+          });
     } else {
       Advance();  // Consume c.
       // The TRV of LineTerminatorSequence :: <CR> is the CV 0x000A.
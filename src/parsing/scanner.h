@@ -95,6 +95,42 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil above, but first uses {find_run} to skip in bulk over
+  // the code units for which {check} is known to be false. {find_run} gets
+  // the buffered code units and returns the length of such a run (see
+  // scanner-simd.h), which is handed to {on_run} to do whatever {check} would
+  // have done for each of them.
+  template <typename FunctionType, typename FindRunFunction,
+            typename RunFunction>
+  V8_INLINE base::uc32 AdvanceUntil(FunctionType check,
+                                    FindRunFunction find_run,
+                                    RunFunction on_run) {
+    while (true) {
+      const uint16_t* cursor = buffer_cursor_;
+      while (true) {
+        base::Vector<const uint16_t> buffered(
+            cursor, static_cast<size_t>(buffer_end_ - cursor));
+        size_t run = find_run(buffered);
+        if (run > 0) {
+          on_run(buffered.SubVector(0, run));
+          cursor += run;
+        }
+        if (cursor == buffer_end_) break;
+        base::uc32 c0 = static_cast<base::uc32>(*cursor);
+        if (check(c0)) {
+          buffer_cursor_ = cursor + 1;
+          return c0;
+        }
+        cursor++;
+      }
+      buffer_cursor_ = buffer_end_;
+      if (!ReadBlockChecked(pos())) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -440,6 +476,14 @@ class V8_EXPORT_PRIVATE Scanner {
 
   bool FoundHtmlComment() const { return found_html_comment_; }
 
+  // Returns true if any magic comment that is reported to the embedder (e.g.
+  // sourceURL) has been scanned.
+  bool SawAnyMagicComment() const {
+    return source_url_.length() > 0 || source_mapping_url_.length() > 0 ||
+           saw_source_mapping_url_magic_comment_at_sign_ ||
+           saw_magic_comment_compile_hints_all_;
+  }
+
   const Utf16CharacterStream* stream() const { return source_; }
 
  private:
@@ -559,6 +603,21 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FunctionType, typename FindRunFunction,
+            typename RunFunction>
+  V8_INLINE void AdvanceUntil(FunctionType check, FindRunFunction find_run,
+                              RunFunction on_run) {
+    c0_ = source_->AdvanceUntil(check, find_run, on_run);
+  }
+
+  // Adds a run of Latin-1 code units found by a scanner_simd search to the
+  // literal (and the raw literal, if {capture_raw}).
+  template <bool capture_raw = false>
+  V8_INLINE void AddLiteralChars(base::Vector<const uint16_t> chars) {
+    if (capture_raw) next().raw_literal_chars.AddLatin1Chars(chars);
+    next().literal_chars.AddLatin1Chars(chars);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
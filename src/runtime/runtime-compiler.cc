@@ -10,6 +10,7 @@
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
@@ -415,6 +416,13 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  // Queued optimization jobs for this function were prepared against the
+  // feedback that just turned out to be wrong. Drop the ones that have not
+  // started yet; the function will be re-optimized with updated feedback.
+  if (isolate->concurrent_recompilation_enabled()) {
+    isolate->optimizing_compile_dispatcher()->CancelJobsFor(*function);
+  }
+
   // Non-OSR'd code is deoptimized unconditionally. If the deoptimization occurs
   // inside the outermost loop containning a loop that can trigger OSR
   // compilation, we remove the OSR code, it will avoid hit the out of date OSR
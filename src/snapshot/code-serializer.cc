@@ -4,7 +4,9 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
@@ -72,11 +74,18 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // Serialize code object.
   DirectHandle<String> source(Cast<String>(script->source()), isolate);
   HandleScope scope(isolate);
-  CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
-                                 source, script->origin_options()));
-  DisallowGarbageCollection no_gc;
-  cs.reference_map()->AddAttachedReference(*source);
-  AlignedCachedData* cached_data = cs.SerializeSharedFunctionInfo(info);
+  uint32_t source_hash =
+      SerializedCodeData::SourceHash(source, script->origin_options());
+  AlignedCachedData* cached_data = nullptr;
+  if (v8_flags.code_cache_chunk_size > 0) {
+    cached_data = SerializeWithChunks(isolate, info, source_hash);
+  }
+  if (cached_data == nullptr) {
+    CodeSerializer cs(isolate, source_hash);
+    DisallowGarbageCollection no_gc;
+    cs.reference_map()->AddAttachedReference(*source);
+    cached_data = cs.SerializeSharedFunctionInfo(info);
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -95,18 +104,391 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
 
 AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
+  return SerializeObjectGraph(info);
+}
+
+AlignedCachedData* CodeSerializer::SerializeObjectGraph(
+    Handle<HeapObject> root) {
   DisallowGarbageCollection no_gc;
 
   VisitRootPointer(Root::kHandleScope, nullptr,
-                   FullObjectSlot(info.location()));
+                   FullObjectSlot(root.location()));
+  SerializeDeferredObjects();
+  Pad();
+
+  SerializedCodeData data(sink_.data(), this);
+
+  return data.GetScriptData();
+}
+
+// static
+AlignedCachedData* CodeSerializer::SerializeWithChunks(
+    Isolate* isolate, Handle<SharedFunctionInfo> info, uint32_t source_hash) {
+  DirectHandle<Script> script(Cast<Script>(info->script()), isolate);
+  DirectHandle<String> source(Cast<String>(script->source()), isolate);
+
+  // Group the inner functions which have plain bytecode into chunks of about
+  // --code-cache-chunk-size bytes of bytecode. Functions are visited in the
+  // order of their function literal ids, i.e. of their positions, and a chunk
+  // only ends after the functions nested in the ones it already has.
+  std::vector<std::vector<Handle<SharedFunctionInfo>>> chunks;
+  {
+    uint32_t chunk_bytecode_size = 0;
+    int chunk_end = 0;
+    SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+    for (Tagged<SharedFunctionInfo> sfi = iter.Next(); !sfi.is_null();
+         sfi = iter.Next()) {
+      if (sfi->is_toplevel() || sfi->HasDebugInfo(isolate) ||
+          !sfi->HasFeedbackMetadata() ||
+          !IsBytecodeArray(sfi->GetTrustedData(isolate))) {
+        continue;
+      }
+      if (chunks.empty() ||
+          (chunk_bytecode_size >= v8_flags.code_cache_chunk_size &&
+           sfi->StartPosition() >= chunk_end)) {
+        chunks.emplace_back();
+        chunk_bytecode_size = 0;
+      }
+      chunks.back().push_back(handle(sfi, isolate));
+      chunk_bytecode_size +=
+          Cast<BytecodeArray>(sfi->GetTrustedData(isolate))->length();
+      chunk_end = std::max(chunk_end, sfi->EndPosition());
+    }
+  }
+  // A single chunk could only be deserialized after the base segment anyway.
+  if (chunks.size() < 2) return nullptr;
+
+  // The base segment contains the chunked functions as if their bytecode had
+  // been flushed (see SharedFunctionInfo::DiscardCompiled).
+  std::vector<DirectHandle<UncompiledData>> uncompiled_data;
+  for (const auto& functions : chunks) {
+    for (Handle<SharedFunctionInfo> sfi : functions) {
+      uncompiled_data.push_back(
+          isolate->factory()->NewUncompiledDataWithoutPreparseData(
+              handle(sfi->inferred_name(), isolate), sfi->StartPosition(),
+              sfi->EndPosition()));
+    }
+  }
+  DisallowGarbageCollection no_gc;
+  ChunkedFunctionMap chunked_functions;
+  for (const auto& functions : chunks) {
+    for (Handle<SharedFunctionInfo> sfi : functions) {
+      chunked_functions.emplace(*sfi,
+                                uncompiled_data[chunked_functions.size()]);
+    }
+  }
+
+  std::vector<std::unique_ptr<AlignedCachedData>> segments;
+  CodeSerializer base(isolate, source_hash);
+  base.chunked_functions_ = &chunked_functions;
+  base.chunk_count_ = static_cast<uint32_t>(chunks.size());
+  base.reference_map()->AddAttachedReference(*source);
+  segments.emplace_back(base.SerializeSharedFunctionInfo(info));
+  for (const auto& functions : chunks) {
+    CodeSerializer cs(isolate, source_hash);
+    cs.base_ = &base;
+    AlignedCachedData* chunk = cs.SerializeChunk(functions);
+    if (chunk == nullptr) return nullptr;
+    segments.emplace_back(chunk);
+  }
+
+  int size = 0;
+  for (const auto& segment : segments) {
+    DCHECK(IsAligned(segment->length(), kPointerAlignment));
+    size += segment->length();
+  }
+  uint8_t* data = NewArray<uint8_t>(size);
+  int offset = 0;
+  for (const auto& segment : segments) {
+    CopyBytes(data + offset, segment->data(), segment->length());
+    offset += segment->length();
+  }
+  DCHECK_EQ(offset, size);
+
+  if (v8_flags.profile_deserialization) {
+    PrintF("[Serializing %zu functions into %zu chunks]\n",
+           chunked_functions.size(), chunks.size());
+  }
+
+  AlignedCachedData* result = new AlignedCachedData(data, size);
+  result->AcquireDataOwnership();
+  return result;
+}
+
+AlignedCachedData* CodeSerializer::SerializeChunk(
+    const std::vector<Handle<SharedFunctionInfo>>& functions) {
+  DisallowGarbageCollection no_gc;
+
+  for (Handle<SharedFunctionInfo> sfi : functions) {
+    Handle<HeapObject> bytecode(
+        Cast<BytecodeArray>(sfi->GetTrustedData(isolate())), isolate());
+    Handle<HeapObject> feedback_metadata(sfi->feedback_metadata(), isolate());
+    VisitRootPointer(Root::kHandleScope, nullptr,
+                     FullObjectSlot(bytecode.location()));
+    VisitRootPointer(Root::kHandleScope, nullptr,
+                     FullObjectSlot(feedback_metadata.location()));
+    compiled_function_literal_ids_.push_back(sfi->function_literal_id());
+  }
   SerializeDeferredObjects();
   Pad();
+  if (chunk_failed_) return nullptr;
 
   SerializedCodeData data(sink_.data(), this);
 
   return data.GetScriptData();
 }
 
+bool CodeSerializer::SerializeBaseReference(Tagged<HeapObject> obj) {
+  DisallowGarbageCollection no_gc;
+  const SerializerReference* reference =
+      base_->reference_map()->LookupReference(obj);
+  if (reference == nullptr) {
+    // Copies of these would not be the objects the base segment links up.
+    if (IsScript(obj) || IsSharedFunctionInfo(obj)) chunk_failed_ = true;
+    return false;
+  }
+  // Base objects are numbered by their attached reference index, followed by
+  // their back reference index.
+  uint32_t import;
+  if (reference->is_attached_reference()) {
+    import = reference->attached_reference_index();
+  } else {
+    DCHECK(reference->is_back_reference());
+    import = base_->reference_map()->attached_reference_count() +
+             reference->back_ref_index();
+  }
+  chunk_imports_.push_back(import);
+  PutAttachedReference(reference_map()->AddAttachedReference(obj));
+  return true;
+}
+
+// static
+ScriptCompiler::CachedData* CodeSerializer::SerializeBundle(
+    Isolate* isolate, const std::vector<Handle<SharedFunctionInfo>>& infos) {
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
+  NestedTimedHistogramScope histogram_timer(
+      isolate->counters()->compile_serialize());
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileSerialize);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileSerialize");
+
+  base::ElapsedTimer timer;
+  if (v8_flags.profile_deserialization) timer.Start();
+  HandleScope scope(isolate);
+  std::vector<DirectHandle<String>> sources;
+  std::vector<uint32_t> source_hashes;
+  for (Handle<SharedFunctionInfo> info : infos) {
+    Tagged<Script> script = Cast<Script>(info->script());
+#if V8_ENABLE_WEBASSEMBLY
+    if (script->ContainsAsmModule()) return nullptr;
+#endif  // V8_ENABLE_WEBASSEMBLY
+    sources.push_back(direct_handle(Cast<String>(script->source()), isolate));
+    source_hashes.push_back(SerializedCodeData::SourceHash(
+        sources.back(), script->origin_options()));
+  }
+
+  // Serialize every script once to find the internalized strings used by
+  // more than one of them. Only these are shared between the scripts by
+  // identity; other objects, such as ScopeInfos and constants, belong to a
+  // single script.
+  Handle<FixedArray> pool;
+  {
+    std::vector<Handle<String>> pooled_strings;
+    {
+      DisallowGarbageCollection no_gc;
+      std::unordered_map<Tagged<String>, int, Object::Hasher> use_counts;
+      for (size_t i = 0; i < infos.size(); ++i) {
+        std::vector<Tagged<String>> internalized_strings;
+        CodeSerializer cs(isolate, source_hashes[i]);
+        cs.internalized_strings_ = &internalized_strings;
+        cs.reference_map()->AddAttachedReference(*sources[i]);
+        delete cs.SerializeSharedFunctionInfo(infos[i]);
+        for (Tagged<String> string : internalized_strings) {
+          if (++use_counts[string] == 2) {
+            pooled_strings.push_back(handle(string, isolate));
+          }
+        }
+      }
+    }
+    pool = isolate->factory()->NewFixedArray(
+        static_cast<int>(pooled_strings.size()), AllocationType::kOld);
+    for (size_t i = 0; i < pooled_strings.size(); ++i) {
+      pool->set(static_cast<int>(i), *pooled_strings[i]);
+    }
+  }
+
+  std::vector<std::unique_ptr<AlignedCachedData>> segments;
+  {
+    CodeSerializer cs(isolate, 0);
+    segments.emplace_back(cs.SerializeObjectGraph(pool));
+  }
+  uint32_t pool_checksum = Checksum(base::Vector<const uint8_t>(
+      segments[0]->data(), segments[0]->length()));
+  // Zero identifies segments without a pool.
+  if (pool_checksum == 0) pool_checksum = 1;
+  for (size_t i = 0; i < infos.size(); ++i) {
+    CodeSerializer cs(isolate, source_hashes[i]);
+    cs.pool_checksum_ = pool_checksum;
+    cs.pool_length_ = static_cast<uint32_t>(pool->length());
+    DisallowGarbageCollection no_gc;
+    cs.reference_map()->AddAttachedReference(*sources[i]);
+    for (int j = 0; j < pool->length(); ++j) {
+      cs.reference_map()->AddAttachedReference(Cast<String>(pool->get(j)));
+    }
+    segments.emplace_back(cs.SerializeSharedFunctionInfo(infos[i]));
+  }
+
+  int script_count = static_cast<int>(infos.size());
+  uint32_t size = CodeCacheBundle::HeaderSize(script_count);
+  for (const auto& segment : segments) {
+    DCHECK(IsAligned(segment->length(), kPointerAlignment));
+    size += segment->length();
+  }
+  uint8_t* data = NewArray<uint8_t>(size);
+  memset(data, 0, CodeCacheBundle::HeaderSize(script_count));
+  auto set_header_value = [data](uint32_t offset, uint32_t value) {
+    base::WriteLittleEndianValue(reinterpret_cast<Address>(data) + offset,
+                                 value);
+  };
+  set_header_value(CodeCacheBundle::kMagicNumberOffset,
+                   CodeCacheBundle::kMagicNumber);
+  set_header_value(CodeCacheBundle::kScriptCountOffset, script_count);
+  set_header_value(CodeCacheBundle::kPoolChecksumOffset, pool_checksum);
+  uint32_t offset = CodeCacheBundle::HeaderSize(script_count);
+  for (size_t i = 0; i < segments.size(); ++i) {
+    if (i > 0) {
+      set_header_value(CodeCacheBundle::kScriptOffsetsOffset +
+                           static_cast<uint32_t>(i - 1) * kUInt32Size,
+                       offset);
+    }
+    CopyBytes(data + offset, segments[i]->data(), segments[i]->length());
+    offset += segments[i]->length();
+  }
+  DCHECK_EQ(offset, size);
+
+  if (v8_flags.profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Serializing %d scripts with %d pooled strings to %u bytes took "
+           "%0.3f ms]\n",
+           script_count, pool->length(), size, ms);
+  }
+
+  return new ScriptCompiler::CachedData(
+      data, static_cast<int>(size), ScriptCompiler::CachedData::BufferOwned);
+}
+
+namespace {
+
+// Marks the function literals which are compiled in |segment|. Fails if the
+// segment refers to function literals the script does not have.
+bool MarkCompiledFunctionLiterals(const SerializedCodeData& segment,
+                                  std::vector<bool>* compiled) {
+  for (int i = 0; i < segment.CompiledFunctionCount(); ++i) {
+    int function_literal_id = segment.CompiledFunctionLiteralId(i);
+    if (function_literal_id < 0 ||
+        static_cast<size_t>(function_literal_id) >= compiled->size()) {
+      return false;
+    }
+    (*compiled)[function_literal_id] = true;
+  }
+  return true;
+}
+
+}  // namespace
+
+// static
+ScriptCompiler::CachedData* CodeSerializer::SerializeDelta(
+    Isolate* isolate, Handle<SharedFunctionInfo> info,
+    AlignedCachedData* cached_data) {
+  TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8", "V8.Execute");
+  NestedTimedHistogramScope histogram_timer(
+      isolate->counters()->compile_serialize());
+  RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileSerialize);
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileSerialize");
+
+  base::ElapsedTimer timer;
+  if (v8_flags.profile_deserialization) timer.Start();
+  Handle<Script> script(Cast<Script>(info->script()), isolate);
+#if V8_ENABLE_WEBASSEMBLY
+  if (script->ContainsAsmModule()) return nullptr;
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+  DirectHandle<String> source(Cast<String>(script->source()), isolate);
+  uint32_t source_hash =
+      SerializedCodeData::SourceHash(source, script->origin_options());
+
+  // Find the function literals which are already compiled in the cache. Each
+  // segment has to pass the checks the consumer applies, otherwise the delta
+  // would never be reached.
+  if (cached_data->length() == 0) return nullptr;
+  std::vector<bool> cached(script->infos()->length());
+  for (uint32_t offset = 0;
+       offset < static_cast<uint32_t>(cached_data->length());) {
+    SerializedCodeSanityCheckResult sanity_check_result =
+        SerializedCodeSanityCheckResult::kSuccess;
+    const SerializedCodeData segment = SerializedCodeData::FromSegment(
+        isolate, cached_data, offset, source_hash, &sanity_check_result);
+    if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+      return nullptr;
+    }
+    if (!MarkCompiledFunctionLiterals(segment, &cached)) return nullptr;
+    offset += segment.SegmentLength();
+  }
+
+  HandleScope scope(isolate);
+  Handle<WeakFixedArray> infos(script->infos(), isolate);
+  Handle<WeakFixedArray> delta_infos = isolate->factory()->NewWeakFixedArray(
+      infos->length(), AllocationType::kOld);
+  CodeSerializer cs(isolate, source_hash);
+  DisallowGarbageCollection no_gc;
+  cs.reference_map()->AddAttachedReference(*source);
+  // SharedFunctionInfos already compiled in the cache are attached in the
+  // order of their function literal ids, which the consumer reproduces from
+  // the preceding segments. Everything else is serialized into the delta.
+  bool has_new_code = false;
+  for (int i = 0; i < infos->length(); ++i) {
+    Tagged<MaybeObject> maybe_info = infos->get(i);
+    Tagged<HeapObject> heap_object;
+    if (cached[i]) {
+      if (!maybe_info.GetHeapObjectIfWeak(&heap_object)) return nullptr;
+      cs.reference_map()->AddAttachedReference(heap_object);
+      continue;
+    }
+    delta_infos->set(i, maybe_info);
+    if (maybe_info.GetHeapObjectIfWeak(&heap_object) &&
+        IsSharedFunctionInfo(heap_object) &&
+        Cast<SharedFunctionInfo>(heap_object)->is_compiled()) {
+      has_new_code = true;
+    }
+  }
+  if (!has_new_code) return nullptr;
+
+  AlignedCachedData* delta = cs.SerializeScriptDelta(script, delta_infos);
+
+  if (v8_flags.profile_deserialization) {
+    double ms = timer.Elapsed().InMillisecondsF();
+    PrintF("[Serializing delta of %d functions to %d bytes took %0.3f ms]\n",
+           static_cast<int>(cs.compiled_function_literal_ids().size()),
+           delta->length(), ms);
+  }
+
+  ScriptCompiler::CachedData* result =
+      new ScriptCompiler::CachedData(delta->data(), delta->length(),
+                                     ScriptCompiler::CachedData::BufferOwned);
+  delta->ReleaseDataOwnership();
+  delete delta;
+
+  return result;
+}
+
+AlignedCachedData* CodeSerializer::SerializeScriptDelta(
+    Handle<Script> script, Handle<WeakFixedArray> delta_infos) {
+  DisallowGarbageCollection no_gc;
+
+  delta_script_ = script;
+  delta_infos_ = delta_infos;
+  return SerializeObjectGraph(script);
+}
+
 void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
                                          SlotType slot_type) {
   ReadOnlyRoots roots(isolate());
@@ -118,14 +500,20 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     if (SerializeRoot(raw)) return;
     if (SerializeBackReference(raw)) return;
     if (SerializeReadOnlyObjectReference(raw, &sink_)) return;
+    if (base_ != nullptr && SerializeBaseReference(raw)) return;
 
     instance_type = raw->map()->instance_type();
     CHECK(!InstanceTypeChecker::IsInstructionStream(instance_type));
+    if (internalized_strings_ != nullptr &&
+        InstanceTypeChecker::IsInternalizedString(instance_type)) {
+      internalized_strings_->push_back(Cast<String>(raw));
+    }
   }
 
   if (InstanceTypeChecker::IsScript(instance_type)) {
     DirectHandle<FixedArray> host_options;
     DirectHandle<UnionOf<Smi, Symbol, Undefined>> context_data;
+    DirectHandle<WeakFixedArray> infos;
     {
       DisallowGarbageCollection no_gc;
       Tagged<Script> script_obj = Cast<Script>(*obj);
@@ -146,6 +534,10 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       host_options =
           direct_handle(script_obj->host_defined_options(), isolate());
       script_obj->set_host_defined_options(roots.empty_fixed_array());
+      if (!delta_script_.is_null() && script_obj == *delta_script_) {
+        infos = direct_handle(script_obj->infos(), isolate());
+        script_obj->set_infos(*delta_infos_);
+      }
     }
     SerializeGeneric(obj, slot_type);
     {
@@ -153,12 +545,15 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
       Tagged<Script> script_obj = Cast<Script>(*obj);
       script_obj->set_host_defined_options(*host_options);
       script_obj->set_context_data(*context_data);
+      if (!infos.is_null()) script_obj->set_infos(*infos);
     }
     return;
   } else if (InstanceTypeChecker::IsSharedFunctionInfo(instance_type)) {
     DirectHandle<DebugInfo> debug_info;
     CachedTieringDecision cached_tiering_decision;
     bool restore_bytecode = false;
+    DirectHandle<BytecodeArray> chunked_bytecode;
+    DirectHandle<FeedbackMetadata> chunked_feedback_metadata;
     {
       DisallowGarbageCollection no_gc;
       Tagged<SharedFunctionInfo> sfi = Cast<SharedFunctionInfo>(*obj);
@@ -178,25 +573,56 @@ void CodeSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
               debug_info->OriginalBytecodeArray(isolate()), isolate());
         }
       }
-      if (v8_flags.profile_guided_optimization) {
+      // Unless requested otherwise, functions that reached an optimizing
+      // tier only keep the information that they ran at all. With
+      // --code-cache-keep-tiering-decisions, the decision is kept, so that
+      // these functions are optimized early (against fresh feedback) once the
+      // cache is consumed. No optimized code is cached either way.
+      if (v8_flags.profile_guided_optimization &&
+          !v8_flags.code_cache_keep_tiering_decisions) {
         cached_tiering_decision = sfi->cached_tiering_decision();
         if (cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
           sfi->set_cached_tiering_decision(
               CachedTieringDecision::kEarlySparkplug);
         }
       }
+      // The compiled data of chunked functions goes into their chunk.
+      if (chunked_functions_ != nullptr) {
+        auto it = chunked_functions_->find(sfi);
+        if (it != chunked_functions_->end()) {
+          chunked_bytecode = direct_handle(
+              Cast<BytecodeArray>(sfi->GetTrustedData(isolate())), isolate());
+          chunked_feedback_metadata =
+              direct_handle(sfi->feedback_metadata(), isolate());
+          Tagged<HeapObject> outer_scope_info =
+              sfi->scope_info()->HasOuterScopeInfo()
+                  ? Tagged<HeapObject>(sfi->scope_info()->OuterScopeInfo())
+                  : Tagged<HeapObject>(roots.the_hole_value());
+          sfi->set_raw_outer_scope_info_or_feedback_metadata(outer_scope_info);
+          sfi->set_uncompiled_data(*it->second);
+        }
+      }
     }
     SerializeGeneric(obj, slot_type);
     DisallowGarbageCollection no_gc;
     Tagged<SharedFunctionInfo> sfi = Cast<SharedFunctionInfo>(*obj);
+    if (!chunked_bytecode.is_null()) {
+      sfi->set_raw_outer_scope_info_or_feedback_metadata(
+          *chunked_feedback_metadata);
+      sfi->set_bytecode_array(*chunked_bytecode);
+    }
     if (restore_bytecode) {
       sfi->SetActiveBytecodeArray(debug_info->DebugBytecodeArray(isolate()),
                                   isolate());
     }
     if (v8_flags.profile_guided_optimization &&
+        !v8_flags.code_cache_keep_tiering_decisions &&
         cached_tiering_decision > CachedTieringDecision::kEarlySparkplug) {
       sfi->set_cached_tiering_decision(cached_tiering_decision);
     }
+    if (sfi->is_compiled() && chunked_bytecode.is_null()) {
+      compiled_function_literal_ids_.push_back(sfi->function_literal_id());
+    }
     return;
   } else if (InstanceTypeChecker::IsUncompiledDataWithoutPreparseDataWithJob(
                  instance_type)) {
@@ -440,6 +866,169 @@ const char* ToString(SerializedCodeSanityCheckResult result) {
       return "read-only snapshot checksum mismatch";
   }
 }
+
+// Merges |delta_script| into |script|, in the same way a newly deserialized
+// script is merged into an existing one.
+void MergeDelta(Isolate* isolate, DirectHandle<Script> script,
+                DirectHandle<Script> delta_script) {
+  BackgroundMergeTask merge;
+  merge.SetUpOnMainThread(isolate, script);
+  merge.BeginMergeInBackground(isolate->AsLocalIsolate(), delta_script);
+  merge.CompleteMergeInForeground(isolate, delta_script);
+}
+
+// Merges the delta segments, which start at |deltas_offset| in |cached_data|
+// after |base| and its |chunks|, into |script| with MergeDelta. A delta which
+// cannot be applied is dropped along with the deltas after it, since those
+// may refer to its functions.
+void DeserializeDeltas(Isolate* isolate, const SerializedCodeData& base,
+                       base::Vector<const SerializedCodeData> chunks,
+                       uint32_t deltas_offset, AlignedCachedData* cached_data,
+                       uint32_t source_hash, DirectHandle<Script> script) {
+  if (deltas_offset >= static_cast<uint32_t>(cached_data->length())) return;
+  Handle<String> source(Cast<String>(script->source()), isolate);
+  std::vector<bool> cached(script->infos()->length());
+  if (!MarkCompiledFunctionLiterals(base, &cached)) return;
+  for (const SerializedCodeData& chunk : chunks) {
+    if (!MarkCompiledFunctionLiterals(chunk, &cached)) return;
+  }
+
+  for (uint32_t offset = deltas_offset;
+       offset < static_cast<uint32_t>(cached_data->length());) {
+    HandleScope scope(isolate);
+    SerializedCodeSanityCheckResult sanity_check_result =
+        SerializedCodeSanityCheckResult::kSuccess;
+    const SerializedCodeData delta = SerializedCodeData::FromSegment(
+        isolate, cached_data, offset, source_hash, &sanity_check_result);
+    if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Cached code delta failed check: %s]\n",
+               ToString(sanity_check_result));
+      }
+      return;
+    }
+
+    // Attach the SharedFunctionInfos which were compiled in the preceding
+    // segments, in the order the producer attached them.
+    std::vector<Handle<HeapObject>> attached_objects;
+    for (size_t i = 0; i < cached.size(); ++i) {
+      if (!cached[i]) continue;
+      Tagged<HeapObject> sfi;
+      if (!script->infos()->get(static_cast<int>(i)).GetHeapObjectIfWeak(
+              &sfi)) {
+        return;
+      }
+      attached_objects.push_back(handle(sfi, isolate));
+    }
+
+    Handle<Script> delta_script;
+    if (!ObjectDeserializer::DeserializeScript(isolate, &delta, source,
+                                               attached_objects)
+             .ToHandle(&delta_script) ||
+        delta_script->infos()->length() != script->infos()->length()) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Deserializing delta failed]\n");
+      }
+      return;
+    }
+
+    MergeDelta(isolate, script, delta_script);
+
+    if (!MarkCompiledFunctionLiterals(delta, &cached)) return;
+    offset += delta.SegmentLength();
+  }
+}
+
+// Like DeserializeDeltas, but off the main thread, where |base_script| is not
+// final yet. Each delta is deserialized into a Script of its own, which is
+// added to |delta_scripts| and merged on the main thread, see MergeDeltas. A
+// delta refers to the SharedFunctionInfo of a function compiled in a
+// preceding segment the way the merged script would: the one in
+// |base_script| if there is one, or else the one of the first delta that
+// has it.
+void DeserializeDeltasOffThread(LocalIsolate* isolate,
+                                const SerializedCodeData& base,
+                                base::Vector<const SerializedCodeData> chunks,
+                                uint32_t deltas_offset,
+                                AlignedCachedData* cached_data,
+                                DirectHandle<Script> base_script,
+                                std::vector<Handle<Script>>* delta_scripts) {
+  if (deltas_offset >= static_cast<uint32_t>(cached_data->length())) return;
+  const int infos_length = base_script->infos()->length();
+  std::vector<bool> cached(infos_length);
+  if (!MarkCompiledFunctionLiterals(base, &cached)) return;
+  for (const SerializedCodeData& chunk : chunks) {
+    if (!MarkCompiledFunctionLiterals(chunk, &cached)) return;
+  }
+
+  auto find_info = [&](int index, Tagged<HeapObject>* info) {
+    if (base_script->infos()->get(index).GetHeapObjectIfWeak(info)) {
+      return true;
+    }
+    for (DirectHandle<Script> delta_script : *delta_scripts) {
+      if (delta_script->infos()->get(index).GetHeapObjectIfWeak(info)) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (uint32_t offset = deltas_offset;
+       offset < static_cast<uint32_t>(cached_data->length());) {
+    LocalHandleScope scope(isolate);
+    // The base segment's source hash is checked against the source on the
+    // main thread.
+    SerializedCodeSanityCheckResult sanity_check_result =
+        SerializedCodeSanityCheckResult::kSuccess;
+    const SerializedCodeData delta = SerializedCodeData::FromSegment(
+        isolate, cached_data, offset, base.SourceHashOfSegment(),
+        &sanity_check_result);
+    if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Cached code delta failed check: %s]\n",
+               ToString(sanity_check_result));
+      }
+      return;
+    }
+
+    std::vector<Handle<HeapObject>> attached_objects;
+    for (int i = 0; i < infos_length; ++i) {
+      if (!cached[i]) continue;
+      Tagged<HeapObject> sfi;
+      if (!find_info(i, &sfi)) return;
+      attached_objects.push_back(handle(sfi, isolate));
+    }
+
+    size_t delta_count = delta_scripts->size();
+    Handle<Script> delta_script;
+    if (!OffThreadObjectDeserializer::DeserializeScript(
+             isolate, &delta, attached_objects, delta_scripts)
+             .ToHandle(&delta_script) ||
+        delta_script->infos()->length() != infos_length) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Deserializing delta failed]\n");
+      }
+      delta_scripts->resize(delta_count);
+      return;
+    }
+
+    if (!MarkCompiledFunctionLiterals(delta, &cached)) return;
+    offset += delta.SegmentLength();
+  }
+}
+
+// Merges the |delta_scripts| deserialized by DeserializeDeltasOffThread into
+// |script|, in order.
+void MergeDeltas(Isolate* isolate,
+                 base::Vector<const Handle<Script>> delta_scripts,
+                 DirectHandle<String> source, DirectHandle<Script> script) {
+  for (Handle<Script> delta_script : delta_scripts) {
+    HandleScope scope(isolate);
+    Script::SetSource(isolate, delta_script, source);
+    MergeDelta(isolate, script, delta_script);
+  }
+}
+
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
@@ -461,12 +1050,22 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
 
   HandleScope scope(isolate);
 
+  uint32_t source_hash =
+      SerializedCodeData::SourceHash(source, script_details.origin_options);
   SerializedCodeSanityCheckResult sanity_check_result =
       SerializedCodeSanityCheckResult::kSuccess;
   const SerializedCodeData scd = SerializedCodeData::FromCachedData(
-      isolate, cached_data,
-      SerializedCodeData::SourceHash(source, script_details.origin_options),
-      &sanity_check_result);
+      isolate, cached_data, source_hash, &sanity_check_result);
+  MaybeHandle<FixedArray> pool;
+  if (sanity_check_result == SerializedCodeSanityCheckResult::kSuccess &&
+      scd.PoolChecksum() != 0) {
+    // The script belongs to a bundle, whose pool has to be open.
+    pool = CodeCacheBundle::FindPool(isolate, scd);
+    if (pool.is_null()) {
+      sanity_check_result = SerializedCodeSanityCheckResult::kInvalidHeader;
+      cached_data->Reject();
+    }
+  }
   if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
     if (v8_flags.profile_deserialization) {
       PrintF("[Cached code failed check: %s]\n", ToString(sanity_check_result));
@@ -478,8 +1077,12 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   }
 
   // Deserialize.
+  uint32_t deltas_offset;
+  const std::vector<SerializedCodeData> chunks =
+      scd.Chunks(isolate, cached_data, &deltas_offset);
   MaybeHandle<SharedFunctionInfo> maybe_result =
-      ObjectDeserializer::DeserializeSharedFunctionInfo(isolate, &scd, source);
+      ObjectDeserializer::DeserializeSharedFunctionInfo(
+          isolate, &scd, source, pool, base::VectorOf(chunks));
 
   Handle<SharedFunctionInfo> result;
   if (!maybe_result.ToHandle(&result)) {
@@ -503,6 +1106,10 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     result = merge.CompleteMergeInForeground(isolate, new_script);
   }
 
+  DeserializeDeltas(isolate, scd, base::VectorOf(chunks), deltas_offset,
+                    cached_data, source_hash,
+                    direct_handle(Cast<Script>(result->script()), isolate));
+
   Tagged<Script> script = Cast<Script>(result->script());
   script->set_deserialized(true);
   BaselineBatchCompileIfSparkplugCompiled(isolate, script);
@@ -552,10 +1159,30 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
     DCHECK(cached_data->rejected());
     return result;
   }
+  MaybeHandle<FixedArray> pool;
+  if (scd.PoolChecksum() != 0) {
+    // The script belongs to a bundle, whose pool has to be open.
+    pool = CodeCacheBundle::FindPool(local_isolate, scd);
+    if (pool.is_null()) {
+      result.sanity_check_result =
+          SerializedCodeSanityCheckResult::kInvalidHeader;
+      cached_data->Reject();
+      return result;
+    }
+  }
 
+  uint32_t deltas_offset;
+  const std::vector<SerializedCodeData> chunks =
+      scd.Chunks(local_isolate, cached_data, &deltas_offset);
   MaybeHandle<SharedFunctionInfo> local_maybe_result =
       OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
-          local_isolate, &scd, &result.scripts);
+          local_isolate, &scd, &result.scripts, pool, base::VectorOf(chunks));
+  if (!local_maybe_result.is_null()) {
+    DCHECK_EQ(result.scripts.size(), 1);
+    DeserializeDeltasOffThread(local_isolate, scd, base::VectorOf(chunks),
+                               deltas_offset, cached_data, result.scripts[0],
+                               &result.delta_scripts);
+  }
 
   result.maybe_result =
       local_isolate->heap()->NewPersistentMaybeHandle(local_maybe_result);
@@ -579,13 +1206,13 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
   // Do a source sanity check now that we have the source. It's important for
   // FromPartiallySanityCheckedCachedData call that the sanity_check_result
   // holds the result of the off-thread sanity check.
+  uint32_t source_hash =
+      SerializedCodeData::SourceHash(source, script_details.origin_options);
   SerializedCodeSanityCheckResult sanity_check_result =
       data.sanity_check_result;
   const SerializedCodeData scd =
       SerializedCodeData::FromPartiallySanityCheckedCachedData(
-          cached_data,
-          SerializedCodeData::SourceHash(source, script_details.origin_options),
-          &sanity_check_result);
+          cached_data, source_hash, &sanity_check_result);
   if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
     // The only case where the deserialization result could exist despite a
     // check failure is on a source mismatch, since we can't test for this
@@ -652,6 +1279,21 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
     isolate->heap()->SetRootScriptList(*list);
   }
 
+  DirectHandle<Script> script(Cast<Script>(result->script()), isolate);
+  if (background_merge_task && !data.delta_scripts.empty() &&
+      *script != *data.scripts[0]) {
+    // The base segment was merged into a script from the compilation cache,
+    // so the deltas refer to SharedFunctionInfos which may not be the ones
+    // that are used now. Deserialize them again against the merged script.
+    uint32_t deltas_offset;
+    const std::vector<SerializedCodeData> chunks =
+        scd.Chunks(isolate, cached_data, &deltas_offset);
+    DeserializeDeltas(isolate, scd, base::VectorOf(chunks), deltas_offset,
+                      cached_data, source_hash, script);
+  } else {
+    MergeDeltas(isolate, base::VectorOf(data.delta_scripts), source, script);
+  }
+
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
     int length = cached_data->length();
@@ -672,7 +1314,15 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   DisallowGarbageCollection no_gc;
 
   // Calculate sizes.
-  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size());
+  const std::vector<int>& compiled_function_literal_ids =
+      cs->compiled_function_literal_ids();
+  uint32_t compiled_function_count =
+      static_cast<uint32_t>(compiled_function_literal_ids.size());
+  const std::vector<uint32_t>& imports = cs->chunk_imports();
+  uint32_t import_count = static_cast<uint32_t>(imports.size());
+  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size()) +
+                  POINTER_SIZE_ALIGN((compiled_function_count + import_count) *
+                                     kUInt32Size);
   DCHECK(IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
@@ -690,6 +1340,11 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
                  Snapshot::ExtractReadOnlySnapshotChecksum(
                      cs->isolate()->snapshot_blob()));
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kCompiledFunctionCountOffset, compiled_function_count);
+  SetHeaderValue(kPoolChecksumOffset, cs->pool_checksum());
+  SetHeaderValue(kPoolLengthOffset, cs->pool_length());
+  SetHeaderValue(kChunkCountOffset, cs->chunk_count());
+  SetHeaderValue(kImportCountOffset, import_count);
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
@@ -697,6 +1352,19 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   // Copy serialized data.
   CopyBytes(data_ + kHeaderSize, payload->data(),
             static_cast<size_t>(payload->size()));
+
+  // Append the compiled function literal ids and the imports, zeroing out the
+  // padding.
+  uint32_t ids_offset = kHeaderSize + static_cast<uint32_t>(payload->size());
+  memset(data_ + ids_offset, 0, size - ids_offset);
+  for (uint32_t i = 0; i < compiled_function_count; ++i) {
+    SetHeaderValue(ids_offset + i * kUInt32Size,
+                   static_cast<uint32_t>(compiled_function_literal_ids[i]));
+  }
+  uint32_t imports_offset = ids_offset + compiled_function_count * kUInt32Size;
+  for (uint32_t i = 0; i < import_count; ++i) {
+    SetHeaderValue(imports_offset + i * kUInt32Size, imports[i]);
+  }
   uint32_t checksum =
       v8_flags.verify_snapshot_checksum ? Checksum(ChecksummedContent()) : 0;
   SetHeaderValue(kChecksumOffset, checksum);
@@ -747,6 +1415,16 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
   if (payload_length > max_payload_length) {
     return SerializedCodeSanityCheckResult::kLengthMismatch;
   }
+  uint32_t compiled_function_count =
+      GetHeaderValue(kCompiledFunctionCountOffset);
+  uint32_t import_count = GetHeaderValue(kImportCountOffset);
+  uint32_t max_trailer_count =
+      (max_payload_length - payload_length) / kUInt32Size;
+  if (compiled_function_count > max_trailer_count ||
+      import_count > max_trailer_count - compiled_function_count ||
+      SegmentLength() > size_) {
+    return SerializedCodeSanityCheckResult::kLengthMismatch;
+  }
   if (v8_flags.verify_snapshot_checksum) {
     uint32_t checksum = GetHeaderValue(kChecksumOffset);
     if (Checksum(ChecksummedContent()) != checksum) {
@@ -781,10 +1459,71 @@ base::Vector<const uint8_t> SerializedCodeData::Payload() const {
   const uint8_t* payload = data_ + kHeaderSize;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
-  DCHECK_EQ(data_ + size_, payload + length);
+  DCHECK_LE(SegmentLength(), size_);
   return base::Vector<const uint8_t>(payload, length);
 }
 
+uint32_t SerializedCodeData::SegmentLength() const {
+  return kHeaderSize + GetHeaderValue(kPayloadLengthOffset) +
+         POINTER_SIZE_ALIGN((GetHeaderValue(kCompiledFunctionCountOffset) +
+                             GetHeaderValue(kImportCountOffset)) *
+                            kUInt32Size);
+}
+
+int SerializedCodeData::CompiledFunctionLiteralId(int index) const {
+  DCHECK_LT(index, CompiledFunctionCount());
+  return GetHeaderValue(kHeaderSize + GetHeaderValue(kPayloadLengthOffset) +
+                        index * kUInt32Size);
+}
+
+uint32_t SerializedCodeData::Import(int index) const {
+  DCHECK_LT(index, ImportCount());
+  return GetHeaderValue(kHeaderSize + GetHeaderValue(kPayloadLengthOffset) +
+                        (CompiledFunctionCount() + index) * kUInt32Size);
+}
+
+template <typename IsolateT>
+std::vector<SerializedCodeData> SerializedCodeData::Chunks(
+    IsolateT* isolate, AlignedCachedData* cached_data, uint32_t* end) const {
+  DisallowGarbageCollection no_gc;
+  DCHECK_EQ(data_, cached_data->data());
+  std::vector<SerializedCodeData> chunks;
+  uint32_t chunk_count = GetHeaderValue(kChunkCountOffset);
+  uint32_t size = static_cast<uint32_t>(cached_data->length());
+  uint32_t offset = SegmentLength();
+  for (uint32_t i = 0; i < chunk_count; ++i) {
+    if (offset >= size || !IsAligned(offset, kPointerAlignment)) {
+      *end = size;
+      return chunks;
+    }
+    SerializedCodeData chunk(cached_data->data() + offset, size - offset);
+    SerializedCodeSanityCheckResult sanity_check_result = chunk.SanityCheck(
+        Snapshot::ExtractReadOnlySnapshotChecksum(isolate->snapshot_blob()),
+        GetHeaderValue(kSourceHashOffset));
+    if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess ||
+        chunk.GetHeaderValue(kChunkCountOffset) != 0 ||
+        chunk.PoolChecksum() != PoolChecksum() ||
+        chunk.PoolLength() != PoolLength()) {
+      if (v8_flags.profile_deserialization) {
+        PrintF("[Cached code chunk failed check: %s]\n",
+               ToString(sanity_check_result));
+      }
+      *end = size;
+      return chunks;
+    }
+    offset += chunk.SegmentLength();
+    chunks.push_back(std::move(chunk));
+  }
+  *end = offset;
+  return chunks;
+}
+
+template std::vector<SerializedCodeData> SerializedCodeData::Chunks(
+    Isolate* isolate, AlignedCachedData* cached_data, uint32_t* end) const;
+template std::vector<SerializedCodeData> SerializedCodeData::Chunks(
+    LocalIsolate* isolate, AlignedCachedData* cached_data,
+    uint32_t* end) const;
+
 SerializedCodeData::SerializedCodeData(AlignedCachedData* data)
     : SerializedData(const_cast<uint8_t*>(data->data()), data->length()) {}
 
@@ -804,6 +1543,37 @@ SerializedCodeData SerializedCodeData::FromCachedData(
   return scd;
 }
 
+template <typename IsolateT>
+SerializedCodeData SerializedCodeData::FromSegment(
+    IsolateT* isolate, AlignedCachedData* cached_data, uint32_t offset,
+    uint32_t expected_source_hash,
+    SerializedCodeSanityCheckResult* rejection_result) {
+  DisallowGarbageCollection no_gc;
+  DCHECK_LT(offset, static_cast<uint32_t>(cached_data->length()));
+  if (!IsAligned(offset, kPointerAlignment)) {
+    *rejection_result = SerializedCodeSanityCheckResult::kLengthMismatch;
+    return SerializedCodeData(nullptr, 0);
+  }
+  SerializedCodeData scd(cached_data->data() + offset,
+                         cached_data->length() - offset);
+  *rejection_result = scd.SanityCheck(
+      Snapshot::ExtractReadOnlySnapshotChecksum(isolate->snapshot_blob()),
+      expected_source_hash);
+  if (*rejection_result != SerializedCodeSanityCheckResult::kSuccess) {
+    return SerializedCodeData(nullptr, 0);
+  }
+  return scd;
+}
+
+template SerializedCodeData SerializedCodeData::FromSegment(
+    Isolate* isolate, AlignedCachedData* cached_data, uint32_t offset,
+    uint32_t expected_source_hash,
+    SerializedCodeSanityCheckResult* rejection_result);
+template SerializedCodeData SerializedCodeData::FromSegment(
+    LocalIsolate* isolate, AlignedCachedData* cached_data, uint32_t offset,
+    uint32_t expected_source_hash,
+    SerializedCodeSanityCheckResult* rejection_result);
+
 SerializedCodeData SerializedCodeData::FromCachedDataWithoutSource(
     LocalIsolate* local_isolate, AlignedCachedData* cached_data,
     SerializedCodeSanityCheckResult* rejection_result) {
@@ -847,5 +1617,110 @@ SerializedCodeData SerializedCodeData::FromPartiallySanityCheckedCachedData(
   return scd;
 }
 
+CodeCacheBundle::CodeCacheBundle(Isolate* isolate, const uint8_t* data,
+                                 int length)
+    : isolate_(isolate), data_(data), length_(length) {
+  uint32_t size = static_cast<uint32_t>(length);
+  if (size < kScriptOffsetsOffset ||
+      GetHeaderValue(kMagicNumberOffset) != kMagicNumber) {
+    return;
+  }
+  uint32_t script_count = GetHeaderValue(kScriptCountOffset);
+  if (script_count > (size - kScriptOffsetsOffset) / kUInt32Size) return;
+  uint32_t header_size = HeaderSize(script_count);
+  if (header_size >= size) return;
+  // The segments follow each other, starting with the pool.
+  uint32_t previous_offset = header_size;
+  for (uint32_t i = 0; i < script_count; ++i) {
+    uint32_t offset = GetHeaderValue(kScriptOffsetsOffset + i * kUInt32Size);
+    if (offset <= previous_offset || offset >= size ||
+        !IsAligned(offset, kPointerAlignment)) {
+      return;
+    }
+    previous_offset = offset;
+  }
+
+  uint32_t pool_end = GetScriptOffset(0, script_count, size);
+  AlignedCachedData pool_data(data + header_size,
+                              static_cast<int>(pool_end - header_size));
+  SerializedCodeSanityCheckResult sanity_check_result =
+      SerializedCodeSanityCheckResult::kSuccess;
+  const SerializedCodeData scd = SerializedCodeData::FromCachedData(
+      isolate, &pool_data, 0, &sanity_check_result);
+  if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+    if (v8_flags.profile_deserialization) {
+      PrintF("[Code cache bundle pool failed check: %s]\n",
+             ToString(sanity_check_result));
+    }
+    return;
+  }
+  HandleScope scope(isolate);
+  Handle<FixedArray> pool;
+  if (!ObjectDeserializer::DeserializeBundlePool(isolate, &scd)
+           .ToHandle(&pool)) {
+    return;
+  }
+
+  pool_ = isolate->global_handles()->Create(*pool);
+  pool_checksum_ = GetHeaderValue(kPoolChecksumOffset);
+  script_count_ = static_cast<int>(script_count);
+  base::MutexGuard guard(isolate->code_cache_bundles_mutex());
+  isolate->code_cache_bundles()->push_back(this);
+}
+
+CodeCacheBundle::~CodeCacheBundle() {
+  if (pool_.is_null()) return;
+  {
+    base::MutexGuard guard(isolate_->code_cache_bundles_mutex());
+    std::vector<CodeCacheBundle*>* bundles = isolate_->code_cache_bundles();
+    bundles->erase(std::find(bundles->begin(), bundles->end(), this));
+  }
+  GlobalHandles::Destroy(pool_.location());
+}
+
+uint32_t CodeCacheBundle::GetScriptOffset(uint32_t index,
+                                          uint32_t script_count,
+                                          uint32_t size) const {
+  if (index == script_count) return size;
+  return GetHeaderValue(kScriptOffsetsOffset + index * kUInt32Size);
+}
+
+base::Vector<const uint8_t> CodeCacheBundle::ScriptSegment(int index) const {
+  DCHECK_LT(index, script_count_);
+  uint32_t script_count = static_cast<uint32_t>(script_count_);
+  uint32_t size = static_cast<uint32_t>(length_);
+  uint32_t begin = GetScriptOffset(index, script_count, size);
+  uint32_t end = GetScriptOffset(index + 1, script_count, size);
+  return base::Vector<const uint8_t>(data_ + begin, end - begin);
+}
+
+bool CodeCacheBundle::HasPoolFor(const SerializedCodeData& data) const {
+  // The script segment attaches the pool strings by index, so a pool of a
+  // different length must not be used even if the checksums collide.
+  return pool_checksum_ == data.PoolChecksum() &&
+         static_cast<uint32_t>(pool_->length()) == data.PoolLength();
+}
+
+// static
+MaybeHandle<FixedArray> CodeCacheBundle::FindPool(
+    Isolate* isolate, const SerializedCodeData& data) {
+  base::MutexGuard guard(isolate->code_cache_bundles_mutex());
+  for (CodeCacheBundle* bundle : *isolate->code_cache_bundles()) {
+    if (bundle->HasPoolFor(data)) return handle(*bundle->pool_, isolate);
+  }
+  return {};
+}
+
+// static
+MaybeHandle<FixedArray> CodeCacheBundle::FindPool(
+    LocalIsolate* isolate, const SerializedCodeData& data) {
+  Isolate* main_isolate = isolate->GetMainThreadIsolateUnsafe();
+  base::MutexGuard guard(main_isolate->code_cache_bundles_mutex());
+  for (CodeCacheBundle* bundle : *main_isolate->code_cache_bundles()) {
+    if (bundle->HasPoolFor(data)) return handle(*bundle->pool_, isolate);
+  }
+  return {};
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,9 @@
 #ifndef V8_SNAPSHOT_CODE_SERIALIZER_H_
 #define V8_SNAPSHOT_CODE_SERIALIZER_H_
 
+#include <unordered_map>
+#include <vector>
+
 #include "src/base/macros.h"
 #include "src/codegen/script-details.h"
 #include "src/snapshot/serializer.h"
@@ -68,15 +71,35 @@ class CodeSerializer : public Serializer {
     friend class CodeSerializer;
     MaybeHandle<SharedFunctionInfo> maybe_result;
     std::vector<Handle<Script>> scripts;
+    // The deltas following the base segment, each deserialized into a Script
+    // of its own, which are merged into the result on the main thread.
+    std::vector<Handle<Script>> delta_scripts;
     std::unique_ptr<PersistentHandles> persistent_handles;
     SerializedCodeSanityCheckResult sanity_check_result;
   };
 
   CodeSerializer(const CodeSerializer&) = delete;
   CodeSerializer& operator=(const CodeSerializer&) = delete;
+  // With --code-cache-chunk-size, the compiled data of the inner functions is
+  // split off into chunks which are deserialized in parallel.
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
       Isolate* isolate, Handle<SharedFunctionInfo> info);
 
+  // Serializes the functions of |info|'s script which were compiled but are
+  // not contained in |cached_data| yet. The result is a delta segment to be
+  // appended to |cached_data|, which references the functions already
+  // contained in it instead of serializing them again. Returns nullptr if
+  // there is nothing to add or if |cached_data| does not match the script.
+  V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* SerializeDelta(
+      Isolate* isolate, Handle<SharedFunctionInfo> info,
+      AlignedCachedData* cached_data);
+
+  // Serializes the code caches of several scripts into a bundle, in which
+  // the strings used by more than one of the scripts are serialized only
+  // once. Returns nullptr if any of the scripts cannot be serialized.
+  V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* SerializeBundle(
+      Isolate* isolate, const std::vector<Handle<SharedFunctionInfo>>& infos);
+
   AlignedCachedData* SerializeSharedFunctionInfo(
       Handle<SharedFunctionInfo> info);
 
@@ -98,6 +121,21 @@ class CodeSerializer : public Serializer {
 
   uint32_t source_hash() const { return source_hash_; }
 
+  // Function literal ids of the compiled SharedFunctionInfos serialized so far.
+  const std::vector<int>& compiled_function_literal_ids() const {
+    return compiled_function_literal_ids_;
+  }
+
+  // Identifies the bundle pool the serialized objects refer to, or 0.
+  uint32_t pool_checksum() const { return pool_checksum_; }
+  // The number of strings in that pool, which are attached after the source.
+  uint32_t pool_length() const { return pool_length_; }
+
+  // The number of chunks following the base segment.
+  uint32_t chunk_count() const { return chunk_count_; }
+  // For a chunk, the base references of its attached objects.
+  const std::vector<uint32_t>& chunk_imports() const { return chunk_imports_; }
+
  protected:
   CodeSerializer(Isolate* isolate, uint32_t source_hash);
   ~CodeSerializer() override { OutputStatistics("CodeSerializer"); }
@@ -107,11 +145,61 @@ class CodeSerializer : public Serializer {
  private:
   void SerializeObjectImpl(Handle<HeapObject> o, SlotType slot_type) override;
 
+  using ChunkedFunctionMap =
+      std::unordered_map<Tagged<SharedFunctionInfo>,
+                         DirectHandle<UncompiledData>, Object::Hasher>;
+
+  AlignedCachedData* SerializeObjectGraph(Handle<HeapObject> root);
+  AlignedCachedData* SerializeScriptDelta(Handle<Script> script,
+                                          Handle<WeakFixedArray> delta_infos);
+  // Returns nullptr if the script is too small to be split, or if the compiled
+  // data of a function refers to objects that can't be copied into a chunk.
+  static AlignedCachedData* SerializeWithChunks(
+      Isolate* isolate, Handle<SharedFunctionInfo> info, uint32_t source_hash);
+  AlignedCachedData* SerializeChunk(
+      const std::vector<Handle<SharedFunctionInfo>>& functions);
+  // Encodes a reference to an object of the base segment, if |obj| is one.
+  bool SerializeBaseReference(Tagged<HeapObject> obj);
+
   DISALLOW_GARBAGE_COLLECTION(no_gc_)
   uint32_t source_hash_;
+  std::vector<int> compiled_function_literal_ids_;
+  // When serializing a delta, the script is serialized with |delta_infos_| in
+  // place of its infos, which omits the functions already in the cache.
+  Handle<Script> delta_script_;
+  Handle<WeakFixedArray> delta_infos_;
+  // When set, receives the internalized strings serialized, which are the
+  // candidates for a bundle pool.
+  std::vector<Tagged<String>>* internalized_strings_ = nullptr;
+  uint32_t pool_checksum_ = 0;
+  uint32_t pool_length_ = 0;
+  // When serializing the base segment of a split code cache, the functions
+  // whose compiled data goes into a chunk are serialized as if their bytecode
+  // had been flushed, with the given UncompiledData.
+  const ChunkedFunctionMap* chunked_functions_ = nullptr;
+  uint32_t chunk_count_ = 0;
+  // When serializing a chunk, the serializer of the base segment. Objects it
+  // serialized are attached to the chunk rather than copied.
+  CodeSerializer* base_ = nullptr;
+  std::vector<uint32_t> chunk_imports_;
+  bool chunk_failed_ = false;
 };
 
 // Wrapper around ScriptData to provide code-serializer-specific functionality.
+//
+// A code cache consists of a base segment, rooted at the top-level
+// SharedFunctionInfo, optionally followed by chunks and then by delta
+// segments, each rooted at the Script (see CodeSerializer::SerializeDelta).
+// Every segment is a header followed by the payload and the function literal
+// ids of the compiled SharedFunctionInfos it contains.
+//
+// Chunks hold the compiled data of functions which the base segment contains
+// in flushed form. The payload of a chunk is rooted at the BytecodeArray and
+// FeedbackMetadata of each of its functions, in the order of their ids. It
+// refers to objects of the base segment as attached objects, whose indices
+// into the attached objects and back references of the base segment follow
+// the ids. Chunks don't refer to each other, so they are deserialized in
+// parallel once the base segment is.
 class SerializedCodeData : public SerializedData {
  public:
   // The data header consists of uint32_t-sized entries:
@@ -122,7 +210,14 @@ class SerializedCodeData : public SerializedData {
       kFlagHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset =
       kReadOnlySnapshotChecksumOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kCompiledFunctionCountOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kPoolChecksumOffset =
+      kCompiledFunctionCountOffset + kUInt32Size;
+  static const uint32_t kPoolLengthOffset = kPoolChecksumOffset + kUInt32Size;
+  static const uint32_t kChunkCountOffset = kPoolLengthOffset + kUInt32Size;
+  static const uint32_t kImportCountOffset = kChunkCountOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kImportCountOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
@@ -142,6 +237,14 @@ class SerializedCodeData : public SerializedData {
   static SerializedCodeData FromPartiallySanityCheckedCachedData(
       AlignedCachedData* cached_data, uint32_t expected_source_hash,
       SerializedCodeSanityCheckResult* rejection_result);
+  // For the segment starting at |offset|, which is checked like in
+  // FromCachedData. Unlike the above, a failed check does not reject the
+  // cached data, since its preceding segments remain usable.
+  template <typename IsolateT>
+  static SerializedCodeData FromSegment(
+      IsolateT* isolate, AlignedCachedData* cached_data, uint32_t offset,
+      uint32_t expected_source_hash,
+      SerializedCodeSanityCheckResult* rejection_result);
 
   // Used when producing.
   SerializedCodeData(const std::vector<uint8_t>* payload,
@@ -152,6 +255,38 @@ class SerializedCodeData : public SerializedData {
 
   base::Vector<const uint8_t> Payload() const;
 
+  // The size of this segment, including its header.
+  uint32_t SegmentLength() const;
+
+  // The hash of the source the segment was produced for.
+  uint32_t SourceHashOfSegment() const {
+    return GetHeaderValue(kSourceHashOffset);
+  }
+
+  int CompiledFunctionCount() const {
+    return GetHeaderValue(kCompiledFunctionCountOffset);
+  }
+  int CompiledFunctionLiteralId(int index) const;
+
+  // Non-zero for the scripts of a bundle, whose pool is attached after the
+  // source.
+  uint32_t PoolChecksum() const { return GetHeaderValue(kPoolChecksumOffset); }
+  // The number of strings in the pool, which the segment attaches after the
+  // source.
+  uint32_t PoolLength() const { return GetHeaderValue(kPoolLengthOffset); }
+
+  int ImportCount() const { return GetHeaderValue(kImportCountOffset); }
+  uint32_t Import(int index) const;
+
+  // Returns the chunks following this base segment in |cached_data|, which
+  // pass the same checks as the base segment. Sets |end| to the offset after
+  // the chunks, or to the end of |cached_data| if a chunk is rejected, since
+  // the segments following it can't be trusted then.
+  template <typename IsolateT>
+  std::vector<SerializedCodeData> Chunks(IsolateT* isolate,
+                                         AlignedCachedData* cached_data,
+                                         uint32_t* end) const;
+
   static uint32_t SourceHash(DirectHandle<String> source,
                              ScriptOriginOptions origin_options);
 
@@ -162,7 +297,7 @@ class SerializedCodeData : public SerializedData {
 
   base::Vector<const uint8_t> ChecksummedContent() const {
     return base::Vector<const uint8_t>(data_ + kHeaderSize,
-                                       size_ - kHeaderSize);
+                                       SegmentLength() - kHeaderSize);
   }
 
   SerializedCodeSanityCheckResult SanityCheck(
@@ -174,6 +309,74 @@ class SerializedCodeData : public SerializedData {
       uint32_t expected_ro_snapshot_checksum) const;
 };
 
+// A code cache bundle holds the code caches of several scripts, which share a
+// pool of the strings used by more than one of them. It consists of
+// uint32_t-sized header entries followed by segments, each of which is a
+// SerializedCodeData:
+// [0] magic number
+// [1] number of scripts
+// [2] checksum of the pool, which identifies it to the script segments
+// [3 + i] offset of the segment of script i
+// ... pool segment, rooted at a FixedArray of the pooled strings
+// ... script segments
+//
+// Opening a bundle deserializes its pool and registers it with the isolate,
+// where the script segments find it once they are consumed.
+class V8_EXPORT_PRIVATE CodeCacheBundle {
+ public:
+  // |data| must outlive the bundle. If the bundle is rejected, it contains no
+  // scripts.
+  CodeCacheBundle(Isolate* isolate, const uint8_t* data, int length);
+  ~CodeCacheBundle();
+  CodeCacheBundle(const CodeCacheBundle&) = delete;
+  CodeCacheBundle& operator=(const CodeCacheBundle&) = delete;
+
+  int script_count() const { return script_count_; }
+  base::Vector<const uint8_t> ScriptSegment(int index) const;
+
+  // Returns the pool of an open bundle with the given checksum and length,
+  // i.e. the one the script segment |data| refers to.
+  static MaybeHandle<FixedArray> FindPool(Isolate* isolate,
+                                          const SerializedCodeData& data);
+  static MaybeHandle<FixedArray> FindPool(LocalIsolate* isolate,
+                                          const SerializedCodeData& data);
+
+  static constexpr uint32_t kMagicNumber = 0xC0DEB000;
+
+ private:
+  friend class CodeSerializer;
+
+  static constexpr uint32_t kMagicNumberOffset = 0;
+  static constexpr uint32_t kScriptCountOffset =
+      kMagicNumberOffset + kUInt32Size;
+  static constexpr uint32_t kPoolChecksumOffset =
+      kScriptCountOffset + kUInt32Size;
+  static constexpr uint32_t kScriptOffsetsOffset =
+      kPoolChecksumOffset + kUInt32Size;
+
+  static uint32_t HeaderSize(int script_count) {
+    return POINTER_SIZE_ALIGN(kScriptOffsetsOffset +
+                              script_count * kUInt32Size);
+  }
+
+  bool HasPoolFor(const SerializedCodeData& data) const;
+
+  uint32_t GetHeaderValue(uint32_t offset) const {
+    return base::ReadLittleEndianValue<uint32_t>(
+        reinterpret_cast<Address>(data_) + offset);
+  }
+  // The end of the bundle for |index| == |script_count|.
+  uint32_t GetScriptOffset(uint32_t index, uint32_t script_count,
+                           uint32_t size) const;
+
+  Isolate* const isolate_;
+  const uint8_t* const data_;
+  const int length_;
+  int script_count_ = 0;
+  uint32_t pool_checksum_ = 0;
+  IndirectHandle<FixedArray> pool_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -9,6 +9,7 @@
 #include "src/common/assert-scope.h"
 #include "src/logging/counters-scopes.h"
 #include "src/snapshot/serializer-deserializer.h"
+#include "src/snapshot/snapshot.h"
 
 namespace v8 {
 namespace internal {
@@ -26,8 +27,8 @@ MaybeHandle<Context> ContextDeserializer::DeserializeContext(
       isolate->counters()->snapshot_deserialize_context());
 
   ContextDeserializer d(isolate, data, can_rehash);
-  MaybeHandle<Object> maybe_result =
-      d.Deserialize(isolate, global_proxy, embedder_fields_deserializer);
+  MaybeHandle<Object> maybe_result = d.Deserialize(
+      isolate, global_proxy, context_index, embedder_fields_deserializer);
 
   if (V8_UNLIKELY(v8_flags.profile_deserialization)) {
     // ATTENTION: The Memory.json benchmark greps for this exact output. Do not
@@ -44,8 +45,32 @@ MaybeHandle<Context> ContextDeserializer::DeserializeContext(
   return Cast<Context>(result);
 }
 
+// static
+Handle<FixedArray> ContextDeserializer::DeserializeLazyProperties(
+    Isolate* isolate, const SnapshotData* data, size_t context_index,
+    bool can_rehash, int offset, int length,
+    DirectHandle<FixedArray> attached_objects) {
+  TRACE_EVENT0("v8", "V8.DeserializeLazyContextProperties");
+  base::ElapsedTimer timer;
+  if (V8_UNLIKELY(v8_flags.profile_deserialization)) timer.Start();
+
+  ContextDeserializer d(isolate,
+                        data->Payload().SubVector(offset, offset + length),
+                        data->GetMagicNumber(), can_rehash);
+  Handle<FixedArray> result = d.DeserializeLazyPropertyValues(attached_objects);
+
+  if (V8_UNLIKELY(v8_flags.profile_deserialization)) {
+    const double ms = timer.Elapsed().InMillisecondsF();
+    PrintF(
+        "[Deserializing lazy properties of context #%zu (%d bytes) took %0.3f "
+        "ms]\n",
+        context_index, length, ms);
+  }
+  return result;
+}
+
 MaybeHandle<Object> ContextDeserializer::Deserialize(
-    Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
+    Isolate* isolate, Handle<JSGlobalProxy> global_proxy, size_t context_index,
     DeserializeEmbedderFieldsCallback embedder_fields_deserializer) {
   // Replace serialized references to the global proxy and its map with the
   // given global proxy and its map.
@@ -62,6 +87,7 @@ MaybeHandle<Object> ContextDeserializer::Deserialize(
     result = ReadObject();
     DCHECK(IsNativeContext(*result));
     DeserializeDeferredObjects();
+    DeserializeLazyPropertiesData(Cast<NativeContext>(result), context_index);
     DeserializeEmbedderFields(Cast<NativeContext>(result),
                               embedder_fields_deserializer);
     DeserializeApiWrapperFields(
@@ -75,6 +101,61 @@ MaybeHandle<Object> ContextDeserializer::Deserialize(
   return result;
 }
 
+Handle<FixedArray> ContextDeserializer::DeserializeLazyPropertyValues(
+    DirectHandle<FixedArray> attached_objects) {
+  for (int i = 0; i < attached_objects->length(); i++) {
+    AddAttachedObject(
+        handle(Cast<HeapObject>(attached_objects->get(i)), isolate()));
+  }
+
+  Handle<FixedArray> result;
+  {
+    DisallowCodeAllocation no_code_allocation;
+
+    result = Cast<FixedArray>(ReadObject());
+    DeserializeDeferredObjects();
+    LogNewMapEvents();
+    WeakenDescriptorArrays();
+  }
+
+  if (should_rehash()) Rehash();
+
+  return result;
+}
+
+void ContextDeserializer::DeserializeLazyPropertiesData(
+    DirectHandle<NativeContext> context, size_t context_index) {
+  if (!source()->HasMore() || source()->Peek() != kLazyPropertiesData) {
+    return;
+  }
+  // Consume `kLazyPropertiesData`.
+  source()->Get();
+  const int attached_objects_count = source()->GetUint30();
+  DirectHandle<FixedArray> attached_objects =
+      isolate()->factory()->NewFixedArray(attached_objects_count,
+                                          AllocationType::kOld);
+  for (int i = 0; i < attached_objects_count; i++) {
+    Tagged<HeapObject> object = *ReadObject();
+    attached_objects->set(i, object);
+  }
+  // Skip the values, they are deserialized on first access.
+  const int length = source()->GetUint30();
+  const int offset = source()->position();
+  source()->Advance(length);
+
+  DisallowGarbageCollection no_gc;
+  Tagged<FixedArray> lazy_properties =
+      Cast<FixedArray>(context->lazy_snapshot_properties());
+  lazy_properties->set(Snapshot::kLazyPropertiesAttachedObjectsIndex,
+                       *attached_objects);
+  lazy_properties->set(Snapshot::kLazyPropertiesContextIndexIndex,
+                       Smi::FromInt(static_cast<int>(context_index)));
+  lazy_properties->set(Snapshot::kLazyPropertiesDataOffsetIndex,
+                       Smi::FromInt(offset));
+  lazy_properties->set(Snapshot::kLazyPropertiesDataLengthIndex,
+                       Smi::FromInt(length));
+}
+
 template <typename T>
 class PlainBuffer {
  public:
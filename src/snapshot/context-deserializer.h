@@ -24,17 +24,36 @@ class V8_EXPORT_PRIVATE ContextDeserializer final
       bool can_rehash, Handle<JSGlobalProxy> global_proxy,
       DeserializeEmbedderFieldsCallback embedder_fields_deserializer);
 
+  // Deserializes the values of the lazy global object properties of a context,
+  // which are stored at the given location in the context's payload.
+  static Handle<FixedArray> DeserializeLazyProperties(
+      Isolate* isolate, const SnapshotData* data, size_t context_index,
+      bool can_rehash, int offset, int length,
+      DirectHandle<FixedArray> attached_objects);
+
  private:
   explicit ContextDeserializer(Isolate* isolate, const SnapshotData* data,
                                bool can_rehash)
-      : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), false,
-                     can_rehash) {}
+      : ContextDeserializer(isolate, data->Payload(), data->GetMagicNumber(),
+                            can_rehash) {}
+  ContextDeserializer(Isolate* isolate, base::Vector<const uint8_t> payload,
+                      uint32_t magic_number, bool can_rehash)
+      : Deserializer(isolate, payload, magic_number, false, can_rehash) {}
 
   // Deserialize a single object and the objects reachable from it.
   MaybeHandle<Object> Deserialize(
       Isolate* isolate, Handle<JSGlobalProxy> global_proxy,
+      size_t context_index,
       DeserializeEmbedderFieldsCallback embedder_fields_deserializer);
 
+  Handle<FixedArray> DeserializeLazyPropertyValues(
+      DirectHandle<FixedArray> attached_objects);
+
+  // Records where the lazy property values are stored, and the objects they
+  // refer to, in the context's lazy_snapshot_properties().
+  void DeserializeLazyPropertiesData(DirectHandle<NativeContext> context,
+                                     size_t context_index);
+
   void DeserializeEmbedderFields(
       Handle<NativeContext> context,
       DeserializeEmbedderFieldsCallback embedder_fields_deserializer);
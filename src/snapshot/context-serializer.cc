@@ -106,9 +106,28 @@ void ContextSerializer::Serialize(Tagged<Context>* o,
       isolate(), context_->native_context(), allow_active_isolate_for_testing(),
       no_gc);
 
+  // The values of lazy global object properties are kept out of the context
+  // snapshot and serialized into a separate section below.
+  Tagged<Object> lazy_properties =
+      context_->native_context()->lazy_snapshot_properties();
+  Tagged<Object> lazy_values = Smi::zero();
+  if (IsFixedArray(lazy_properties)) {
+    lazy_values = Cast<FixedArray>(lazy_properties)
+                      ->get(Snapshot::kLazyPropertiesValuesIndex);
+    Cast<FixedArray>(lazy_properties)
+        ->set(Snapshot::kLazyPropertiesValuesIndex,
+              ReadOnlyRoots(isolate()).undefined_value());
+  }
+
   VisitRootPointer(Root::kStartupObjectCache, nullptr, FullObjectSlot(o));
   SerializeDeferredObjects();
 
+  if (IsFixedArray(lazy_values)) {
+    SerializeLazyPropertyValues(Cast<FixedArray>(lazy_values));
+    Cast<FixedArray>(lazy_properties)
+        ->set(Snapshot::kLazyPropertiesValuesIndex, lazy_values);
+  }
+
   // Add section for embedder-serialized embedder fields.
   if (!embedder_fields_sink_.data()->empty()) {
     sink_.Put(kEmbedderFieldsData, "embedder fields data");
@@ -126,6 +145,38 @@ void ContextSerializer::Serialize(Tagged<Context>* o,
   Pad();
 }
 
+void ContextSerializer::SerializeLazyPropertyValues(Tagged<FixedArray> values) {
+  ContextSerializer lazy_serializer(isolate(), flags(), startup_serializer_,
+                                    serialize_embedder_fields_);
+  lazy_serializer.context_ = context_;
+  lazy_serializer.main_serializer_ = this;
+  lazy_serializer.VisitRootPointer(Root::kStartupObjectCache, nullptr,
+                                   FullObjectSlot(&values));
+  lazy_serializer.SerializeDeferredObjects();
+  // Embedder fields are only deserialized together with the context.
+  CHECK(lazy_serializer.embedder_fields_sink_.data()->empty());
+  CHECK(lazy_serializer.api_wrapper_sink_.data()->empty());
+  can_be_rehashed_ = can_be_rehashed_ && lazy_serializer.can_be_rehashed();
+
+  // The section starts with the objects of the context snapshot that the lazy
+  // values refer to, so that they can be attached when the values are
+  // deserialized. It is followed by the serialized values themselves, which
+  // the context deserializer skips.
+  sink_.Put(kLazyPropertiesData, "lazy properties data");
+  sink_.PutUint30(
+      static_cast<uint32_t>(lazy_serializer.attached_objects_.size()),
+      "lazy properties attached object count");
+  for (Tagged<HeapObject> object : lazy_serializer.attached_objects_) {
+    VisitRootPointer(Root::kStartupObjectCache, nullptr,
+                     FullObjectSlot(&object));
+  }
+  const std::vector<uint8_t>* data = lazy_serializer.Payload();
+  sink_.PutUint30(static_cast<uint32_t>(data->size()),
+                  "lazy properties data size");
+  sink_.PutRaw(data->data(), static_cast<int>(data->size()),
+               "lazy properties data");
+}
+
 v8::StartupData InternalFieldSerializeWrapper(
     int index, bool field_is_nullptr,
     v8::SerializeInternalFieldsCallback user_callback,
@@ -177,6 +228,14 @@ void ContextSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
     if (SerializeReadOnlyObjectReference(raw, &sink_)) return;
   }
 
+  if (main_serializer_ != nullptr &&
+      main_serializer_->ReferenceMapContains(obj)) {
+    reference_map()->AddAttachedReference(*obj);
+    attached_objects_.push_back(*obj);
+    SerializeBackReference(*obj);
+    return;
+  }
+
   if (startup_serializer_->SerializeUsingSharedHeapObjectCache(&sink_, obj)) {
     return;
   }
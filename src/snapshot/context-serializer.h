@@ -47,6 +47,10 @@ class V8_EXPORT_PRIVATE ContextSerializer : public Serializer {
   // object.
   void SerializeApiWrapperFields(Handle<JSObject> js_object);
 
+  // Serializes the values of the lazy global object properties into a
+  // separate section, see Snapshot::PrepareLazyContextProperties.
+  void SerializeLazyPropertyValues(Tagged<FixedArray> values);
+
   StartupSerializer* startup_serializer_;
   SerializeEmbedderFieldsCallback serialize_embedder_fields_;
   // Indicates whether we only serialized hash tables that we can rehash.
@@ -58,6 +62,12 @@ class V8_EXPORT_PRIVATE ContextSerializer : public Serializer {
   SnapshotByteSink embedder_fields_sink_;
   // Used to store serialized data for API wrappers.
   SnapshotByteSink api_wrapper_sink_;
+
+  // When serializing the values of lazy global object properties, the
+  // serializer of the context itself. Objects that it has already serialized
+  // are referenced from the lazy values through attached references.
+  ContextSerializer* main_serializer_ = nullptr;
+  std::vector<Tagged<HeapObject>> attached_objects_;
 };
 
 }  // namespace internal
@@ -75,6 +75,13 @@ class Deserializer : public SerializerDeserializer {
   void AddAttachedObject(Handle<HeapObject> attached_object) {
     attached_objects_.push_back(attached_object);
   }
+  const std::vector<Handle<HeapObject>>& attached_objects() const {
+    return attached_objects_;
+  }
+  // The objects deserialized so far, in the order of their back references.
+  const std::vector<Handle<HeapObject>>& back_refs() const {
+    return back_refs_;
+  }
 
   IsolateT* isolate() const { return isolate_; }
 
@@ -4,16 +4,253 @@
 
 #include "src/snapshot/object-deserializer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "include/v8-platform.h"
 #include "src/execution/isolate.h"
+#include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/heap/local-heap-inl.h"
+#include "src/heap/parked-scope.h"
+#include "src/init/v8.h"
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/objects.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/snapshot/code-serializer.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Deserializes a chunk of a code cache, which refers to objects of the base
+// segment, and links the compiled data into the SharedFunctionInfos.
+class ChunkDeserializer final : public Deserializer<LocalIsolate> {
+ public:
+  ChunkDeserializer(LocalIsolate* isolate, const SerializedCodeData* data)
+      : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
+                     false),
+        data_(data) {}
+
+  // Returns false if the chunk doesn't match the base segment, in which case
+  // its functions stay lazily compiled.
+  bool Deserialize(const std::vector<Handle<HeapObject>>& base_attached_objects,
+                   const std::vector<Handle<HeapObject>>& base_back_refs,
+                   Handle<WeakFixedArray> infos) {
+    DCHECK(deserializing_user_code());
+    size_t base_object_count =
+        base_attached_objects.size() + base_back_refs.size();
+    for (int i = 0; i < data_->ImportCount(); ++i) {
+      size_t index = data_->Import(i);
+      if (index >= base_object_count) return false;
+      AddAttachedObject(index < base_attached_objects.size()
+                            ? base_attached_objects[index]
+                            : base_back_refs[index -
+                                             base_attached_objects.size()]);
+    }
+
+    int count = data_->CompiledFunctionCount();
+    std::vector<Handle<HeapObject>> objects;
+    objects.reserve(2 * count);
+    for (int i = 0; i < 2 * count; ++i) objects.push_back(ReadObject());
+    DeserializeDeferredObjects();
+    CHECK(new_code_objects().empty());
+    CHECK(new_allocation_sites().empty());
+    CHECK(new_maps().empty());
+    CHECK(new_scripts().empty());
+    WeakenDescriptorArrays();
+    Rehash();
+
+    DisallowGarbageCollection no_gc;
+    std::vector<Tagged<SharedFunctionInfo>> infos_to_link;
+    infos_to_link.reserve(count);
+    for (int i = 0; i < count; ++i) {
+      int function_literal_id = data_->CompiledFunctionLiteralId(i);
+      Tagged<HeapObject> info;
+      if (function_literal_id < 0 || function_literal_id >= infos->length() ||
+          !infos->get(function_literal_id).GetHeapObjectIfWeak(&info) ||
+          !IsSharedFunctionInfo(info) ||
+          !Cast<SharedFunctionInfo>(info)
+               ->HasUncompiledDataWithoutPreparseData() ||
+          !IsBytecodeArray(*objects[2 * i]) ||
+          !IsFeedbackMetadata(*objects[2 * i + 1])) {
+        return false;
+      }
+      infos_to_link.push_back(Cast<SharedFunctionInfo>(info));
+    }
+    for (int i = 0; i < count; ++i) {
+      Tagged<SharedFunctionInfo> sfi = infos_to_link[i];
+      sfi->set_feedback_metadata(Cast<FeedbackMetadata>(*objects[2 * i + 1]),
+                                 kReleaseStore);
+      sfi->set_bytecode_array(Cast<BytecodeArray>(*objects[2 * i]));
+    }
+    return true;
+  }
+
+ private:
+  const SerializedCodeData* const data_;
+};
+
+// The handles through which a worker thread refers to the objects of the base
+// segment. They are copies of the joining thread's handles, which only the
+// joining thread may use, and are attached to the LocalHeap of the worker
+// while it deserializes chunks.
+struct ChunkWorkerHandles {
+  ChunkWorkerHandles(Isolate* isolate,
+                     const std::vector<Handle<HeapObject>>& attached_objects,
+                     const std::vector<Handle<HeapObject>>& back_refs,
+                     Handle<WeakFixedArray> script_infos)
+      : persistent_handles(std::make_unique<PersistentHandles>(isolate)) {
+    base_attached_objects.reserve(attached_objects.size());
+    for (Handle<HeapObject> object : attached_objects) {
+      base_attached_objects.push_back(persistent_handles->NewHandle(object));
+    }
+    base_back_refs.reserve(back_refs.size());
+    for (Handle<HeapObject> object : back_refs) {
+      base_back_refs.push_back(persistent_handles->NewHandle(object));
+    }
+    infos = persistent_handles->NewHandle(script_infos);
+  }
+
+  std::unique_ptr<PersistentHandles> persistent_handles;
+  std::vector<Handle<HeapObject>> base_attached_objects;
+  std::vector<Handle<HeapObject>> base_back_refs;
+  Handle<WeakFixedArray> infos;
+};
+
+// Deserializes the chunks of a code cache, claiming them one at a time, on
+// the joining thread and on as many worker threads as there are chunks left.
+class ChunkDeserializationJob final : public JobTask {
+ public:
+  ChunkDeserializationJob(
+      Isolate* isolate, LocalIsolate* joining_isolate,
+      base::Vector<const SerializedCodeData> chunks,
+      const std::vector<Handle<HeapObject>>& base_attached_objects,
+      const std::vector<Handle<HeapObject>>& base_back_refs,
+      Handle<WeakFixedArray> infos, size_t max_workers)
+      : isolate_(isolate),
+        joining_isolate_(joining_isolate),
+        chunks_(chunks),
+        base_attached_objects_(base_attached_objects),
+        base_back_refs_(base_back_refs),
+        infos_(infos) {
+    // Task ids are below the number of threads running the job, which
+    // includes the joining thread.
+    worker_handles_.reserve(max_workers);
+    for (size_t i = 0; i < max_workers; ++i) {
+      worker_handles_.emplace_back(isolate, base_attached_objects,
+                                   base_back_refs, infos);
+    }
+  }
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8", "V8.DeserializeCodeCacheChunks");
+    if (delegate->IsJoiningThread()) {
+      if (v8_flags.stress_code_cache_chunk_workers) return;
+      UnparkedScope unparked_scope(joining_isolate_);
+      RunOn(joining_isolate_, delegate, base_attached_objects_,
+            base_back_refs_, infos_);
+    } else {
+      CHECK_LT(delegate->GetTaskId(), worker_handles_.size());
+      ChunkWorkerHandles& handles = worker_handles_[delegate->GetTaskId()];
+      LocalIsolate local_isolate(isolate_, ThreadKind::kBackground);
+      local_isolate.heap()->AttachPersistentHandles(
+          std::move(handles.persistent_handles));
+      {
+        UnparkedScope unparked_scope(&local_isolate);
+        RunOn(&local_isolate, delegate, handles.base_attached_objects,
+              handles.base_back_refs, handles.infos);
+      }
+      handles.persistent_handles =
+          local_isolate.heap()->DetachPersistentHandles();
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    if (next_chunk >= chunks_.size()) return 0;
+    size_t concurrency = chunks_.size() - next_chunk;
+    // Leave room for a worker next to the joining thread, which doesn't
+    // claim any chunks.
+    if (v8_flags.stress_code_cache_chunk_workers) concurrency++;
+    return std::min(concurrency, worker_handles_.size());
+  }
+
+ private:
+  void RunOn(LocalIsolate* local_isolate, JobDelegate* delegate,
+             const std::vector<Handle<HeapObject>>& base_attached_objects,
+             const std::vector<Handle<HeapObject>>& base_back_refs,
+             Handle<WeakFixedArray> infos) {
+    do {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_.size()) return;
+      LocalHandleScope handle_scope(local_isolate);
+      ChunkDeserializer d(local_isolate, &chunks_[index]);
+      if (!d.Deserialize(base_attached_objects, base_back_refs, infos) &&
+          v8_flags.profile_deserialization) {
+        PrintF("[Deserializing code cache chunk %zu failed]\n", index);
+      }
+    } while (!delegate->ShouldYield());
+  }
+
+  Isolate* const isolate_;
+  LocalIsolate* const joining_isolate_;
+  const base::Vector<const SerializedCodeData> chunks_;
+  const std::vector<Handle<HeapObject>>& base_attached_objects_;
+  const std::vector<Handle<HeapObject>>& base_back_refs_;
+  const Handle<WeakFixedArray> infos_;
+  std::vector<ChunkWorkerHandles> worker_handles_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+// Deserializes |chunks| into the functions of |script|, whose base segment
+// was deserialized into |base_attached_objects| and |base_back_refs|. The
+// calling thread is parked while the chunks are deserialized.
+void DeserializeChunks(
+    Isolate* isolate, LocalIsolate* joining_isolate,
+    base::Vector<const SerializedCodeData> chunks,
+    const std::vector<Handle<HeapObject>>& base_attached_objects,
+    const std::vector<Handle<HeapObject>>& base_back_refs,
+    DirectHandle<Script> script) {
+  if (chunks.empty()) return;
+  Handle<WeakFixedArray> infos = handle(script->infos(), joining_isolate);
+  if ((chunks.size() <= 1 && !v8_flags.stress_code_cache_chunk_workers) ||
+      v8_flags.single_threaded) {
+    class NeverYieldDelegate final : public JobDelegate {
+     public:
+      bool ShouldYield() override { return false; }
+      bool IsJoiningThread() const override { return true; }
+      void NotifyConcurrencyIncrease() override {}
+      uint8_t GetTaskId() override { return 0; }
+    };
+    ChunkDeserializationJob job(isolate, joining_isolate, chunks,
+                                base_attached_objects, base_back_refs, infos,
+                                0);
+    joining_isolate->heap()->ExecuteWhileParked([&]() {
+      NeverYieldDelegate delegate;
+      job.Run(&delegate);
+    });
+    return;
+  }
+  v8::Platform* platform = V8::GetCurrentPlatform();
+  // The handles for the workers are set up before the joining thread parks.
+  size_t max_workers = std::min(
+      chunks.size() + 1,
+      static_cast<size_t>(platform->NumberOfWorkerThreads()) + 1);
+  auto job = std::make_unique<ChunkDeserializationJob>(
+      isolate, joining_isolate, chunks, base_attached_objects, base_back_refs,
+      infos, max_workers);
+  joining_isolate->heap()->ExecuteWhileParked([&]() {
+    platform->CreateJob(TaskPriority::kUserBlocking, std::move(job))->Join();
+  });
+}
+
+}  // namespace
+
 ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
                                        const SerializedCodeData* data)
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), true,
@@ -21,16 +258,50 @@ ObjectDeserializer::ObjectDeserializer(Isolate* isolate,
 
 MaybeHandle<SharedFunctionInfo>
 ObjectDeserializer::DeserializeSharedFunctionInfo(
-    Isolate* isolate, const SerializedCodeData* data, Handle<String> source) {
+    Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+    MaybeHandle<FixedArray> pool,
+    base::Vector<const SerializedCodeData> chunks) {
   ObjectDeserializer d(isolate, data);
+  d.chunks_ = chunks;
 
   d.AddAttachedObject(source);
+  if (Handle<FixedArray> pool_array; pool.ToHandle(&pool_array)) {
+    CHECK_EQ(static_cast<uint32_t>(pool_array->length()), data->PoolLength());
+    for (int i = 0; i < pool_array->length(); ++i) {
+      d.AddAttachedObject(
+          handle(Cast<HeapObject>(pool_array->get(i)), isolate));
+    }
+  }
 
   Handle<HeapObject> result;
   return d.Deserialize().ToHandle(&result) ? Cast<SharedFunctionInfo>(result)
                                            : MaybeHandle<SharedFunctionInfo>();
 }
 
+MaybeHandle<FixedArray> ObjectDeserializer::DeserializeBundlePool(
+    Isolate* isolate, const SerializedCodeData* data) {
+  ObjectDeserializer d(isolate, data);
+
+  Handle<HeapObject> result;
+  return d.Deserialize().ToHandle(&result) ? Cast<FixedArray>(result)
+                                           : MaybeHandle<FixedArray>();
+}
+
+MaybeHandle<Script> ObjectDeserializer::DeserializeScript(
+    Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+    const std::vector<Handle<HeapObject>>& attached_objects) {
+  ObjectDeserializer d(isolate, data);
+
+  d.AddAttachedObject(source);
+  for (Handle<HeapObject> attached_object : attached_objects) {
+    d.AddAttachedObject(attached_object);
+  }
+
+  Handle<HeapObject> result;
+  return d.Deserialize().ToHandle(&result) ? Cast<Script>(result)
+                                           : MaybeHandle<Script>();
+}
+
 MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   DCHECK(deserializing_user_code());
   HandleScope scope(isolate());
@@ -45,6 +316,13 @@ MaybeHandle<HeapObject> ObjectDeserializer::Deserialize() {
   }
 
   Rehash();
+  if (!chunks_.empty()) {
+    DeserializeChunks(
+        isolate(), isolate()->main_thread_local_isolate(), chunks_,
+        attached_objects(), back_refs(),
+        direct_handle(Cast<Script>(Cast<SharedFunctionInfo>(result)->script()),
+                      isolate()));
+  }
   CommitPostProcessedObjects();
   return scope.CloseAndEscape(result);
 }
@@ -89,11 +367,21 @@ OffThreadObjectDeserializer::OffThreadObjectDeserializer(
 MaybeHandle<SharedFunctionInfo>
 OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
     LocalIsolate* isolate, const SerializedCodeData* data,
-    std::vector<Handle<Script>>* deserialized_scripts) {
+    std::vector<Handle<Script>>* deserialized_scripts,
+    MaybeHandle<FixedArray> pool,
+    base::Vector<const SerializedCodeData> chunks) {
   OffThreadObjectDeserializer d(isolate, data);
+  d.chunks_ = chunks;
 
   // Attach the empty string as the source.
   d.AddAttachedObject(isolate->factory()->empty_string());
+  if (Handle<FixedArray> pool_array; pool.ToHandle(&pool_array)) {
+    CHECK_EQ(static_cast<uint32_t>(pool_array->length()), data->PoolLength());
+    for (int i = 0; i < pool_array->length(); ++i) {
+      d.AddAttachedObject(
+          handle(Cast<HeapObject>(pool_array->get(i)), isolate));
+    }
+  }
 
   Handle<HeapObject> result;
   if (!d.Deserialize(deserialized_scripts).ToHandle(&result)) {
@@ -102,6 +390,23 @@ OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
   return Cast<SharedFunctionInfo>(result);
 }
 
+MaybeHandle<Script> OffThreadObjectDeserializer::DeserializeScript(
+    LocalIsolate* isolate, const SerializedCodeData* data,
+    const std::vector<Handle<HeapObject>>& attached_objects,
+    std::vector<Handle<Script>>* deserialized_scripts) {
+  OffThreadObjectDeserializer d(isolate, data);
+
+  d.AddAttachedObject(isolate->factory()->empty_string());
+  for (Handle<HeapObject> attached_object : attached_objects) {
+    d.AddAttachedObject(attached_object);
+  }
+
+  Handle<HeapObject> result;
+  return d.Deserialize(deserialized_scripts).ToHandle(&result)
+             ? Cast<Script>(result)
+             : MaybeHandle<Script>();
+}
+
 MaybeHandle<HeapObject> OffThreadObjectDeserializer::Deserialize(
     std::vector<Handle<Script>>* deserialized_scripts) {
   DCHECK(deserializing_user_code());
@@ -117,6 +422,13 @@ MaybeHandle<HeapObject> OffThreadObjectDeserializer::Deserialize(
   }
 
   Rehash();
+  if (!chunks_.empty()) {
+    DeserializeChunks(
+        isolate()->GetMainThreadIsolateUnsafe(), isolate(), chunks_,
+        attached_objects(), back_refs(),
+        direct_handle(Cast<Script>(Cast<SharedFunctionInfo>(result)->script()),
+                      isolate()));
+  }
 
   // TODO(leszeks): Figure out a better way of dealing with scripts.
   CHECK_EQ(new_scripts().size(), 1);
@@ -5,6 +5,9 @@
 #ifndef V8_SNAPSHOT_OBJECT_DESERIALIZER_H_
 #define V8_SNAPSHOT_OBJECT_DESERIALIZER_H_
 
+#include <vector>
+
+#include "src/base/vector.h"
 #include "src/snapshot/deserializer.h"
 
 namespace v8 {
@@ -16,8 +19,20 @@ class SharedFunctionInfo;
 // Deserializes the object graph rooted at a given object.
 class ObjectDeserializer final : public Deserializer<Isolate> {
  public:
+  // The elements of |pool|, if given, are attached after the source. The
+  // |chunks| following |data| are deserialized in parallel afterwards.
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
-      Isolate* isolate, const SerializedCodeData* data, Handle<String> source);
+      Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+      MaybeHandle<FixedArray> pool = {},
+      base::Vector<const SerializedCodeData> chunks = {});
+  // Deserializes the pool of a code cache bundle.
+  static MaybeHandle<FixedArray> DeserializeBundlePool(
+      Isolate* isolate, const SerializedCodeData* data);
+  // Deserializes a code cache delta, which is rooted at a Script and refers
+  // to |attached_objects| after the source.
+  static MaybeHandle<Script> DeserializeScript(
+      Isolate* isolate, const SerializedCodeData* data, Handle<String> source,
+      const std::vector<Handle<HeapObject>>& attached_objects);
 
  private:
   explicit ObjectDeserializer(Isolate* isolate, const SerializedCodeData* data);
@@ -27,6 +42,8 @@ class ObjectDeserializer final : public Deserializer<Isolate> {
 
   void LinkAllocationSites();
   void CommitPostProcessedObjects();
+
+  base::Vector<const SerializedCodeData> chunks_;
 };
 
 // Deserializes the object graph rooted at a given object.
@@ -34,6 +51,14 @@ class OffThreadObjectDeserializer final : public Deserializer<LocalIsolate> {
  public:
   static MaybeHandle<SharedFunctionInfo> DeserializeSharedFunctionInfo(
       LocalIsolate* isolate, const SerializedCodeData* data,
+      std::vector<Handle<Script>>* deserialized_scripts,
+      MaybeHandle<FixedArray> pool = {},
+      base::Vector<const SerializedCodeData> chunks = {});
+  // Deserializes a code cache delta like ObjectDeserializer::DeserializeScript,
+  // with the empty string attached as the source.
+  static MaybeHandle<Script> DeserializeScript(
+      LocalIsolate* isolate, const SerializedCodeData* data,
+      const std::vector<Handle<HeapObject>>& attached_objects,
       std::vector<Handle<Script>>* deserialized_scripts);
 
  private:
@@ -43,6 +68,8 @@ class OffThreadObjectDeserializer final : public Deserializer<LocalIsolate> {
   // Deserialize an object graph. Fail gracefully.
   MaybeHandle<HeapObject> Deserialize(
       std::vector<Handle<Script>>* deserialized_scripts);
+
+  base::Vector<const SerializedCodeData> chunks_;
 };
 
 }  // namespace internal
@@ -4,6 +4,9 @@
 
 #include "src/snapshot/read-only-deserializer.h"
 
+#include <atomic>
+
+#include "src/base/platform/platform.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/read-only-heap.h"
@@ -13,10 +16,17 @@
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/utils/allocation.h"
+#include "src/utils/memcopy.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+// See ReadOnlyDeserializer::mapped_bytes_for_testing.
+std::atomic<size_t> mapped_bytes{0};
+}  // namespace
+
 class ReadOnlyHeapImageDeserializer final {
  public:
   static void Deserialize(Isolate* isolate, SnapshotByteSource* source) {
@@ -41,7 +51,10 @@ class ReadOnlyHeapImageDeserializer final {
           AllocatePage(true);
           break;
         case Bytecode::kSegment:
-          DeserializeSegment();
+          DeserializeSegment(false);
+          break;
+        case Bytecode::kMappableSegment:
+          DeserializeSegment(true);
           break;
         case Bytecode::kRelocateSegment:
           UNREACHABLE();  // Handled together with kSegment.
@@ -76,7 +89,7 @@ class ReadOnlyHeapImageDeserializer final {
                                                  area_size_in_bytes);
   }
 
-  void DeserializeSegment() {
+  void DeserializeSegment(bool mappable) {
     uint32_t page_index = source_->GetUint30();
     ReadOnlyPageMetadata* page = PageAt(page_index);
 
@@ -84,6 +97,13 @@ class ReadOnlyHeapImageDeserializer final {
     Address start = page->area_start() + source_->GetUint30();
     int size_in_bytes = source_->GetUint30();
     CHECK_LE(start + size_in_bytes, page->area_end());
+    if (mappable) {
+      CHECK(V8_STATIC_ROOTS_BOOL);
+      int padding_size = static_cast<int>(source_->GetUint32());
+      source_->Advance(padding_size);
+      MapOrCopyRaw(start, size_in_bytes);
+      return;
+    }
     source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
 
     if (!V8_STATIC_ROOTS_BOOL) {
@@ -99,6 +119,44 @@ class ReadOnlyHeapImageDeserializer final {
     }
   }
 
+  // Maps the OS pages which are fully covered by the segment copy-on-write
+  // from the snapshot file, if the snapshot blob is backed by one and the
+  // segment contents are congruent to their target address modulo the page
+  // size. Everything else is copied.
+  //
+  // This is restricted to Linux, where RemapPages maps the file MAP_PRIVATE.
+  // Elsewhere (e.g. mach_vm_remap on Darwin), the new mapping shares the
+  // pages with the blob, so post-processing would write through to it.
+  void MapOrCopyRaw(Address start, int size_in_bytes) {
+#if V8_OS_LINUX
+    if constexpr (base::OS::IsRemapPageSupported()) {
+      const size_t page_size = GetPlatformPageAllocator()->AllocatePageSize();
+      const Address contents =
+          reinterpret_cast<Address>(source_->data() + source_->position());
+      const Address end = start + size_in_bytes;
+      const Address map_start = RoundUp(start, page_size);
+      const Address map_end = RoundDown(end, page_size);
+      const Address map_contents = contents + (map_start - start);
+      if (v8_flags.map_read_only_snapshot && map_start < map_end &&
+          IsAligned(map_contents, page_size) &&
+          base::OS::RemapPages(reinterpret_cast<const void*>(map_contents),
+                               map_end - map_start,
+                               reinterpret_cast<void*>(map_start),
+                               base::OS::MemoryPermission::kReadWrite)) {
+        MemCopy(reinterpret_cast<void*>(start),
+                reinterpret_cast<const void*>(contents), map_start - start);
+        MemCopy(reinterpret_cast<void*>(map_end),
+                reinterpret_cast<const void*>(contents + (map_end - start)),
+                end - map_end);
+        source_->Advance(size_in_bytes);
+        mapped_bytes.fetch_add(map_end - map_start, std::memory_order_relaxed);
+        return;
+      }
+    }
+#endif  // V8_OS_LINUX
+    source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
+  }
+
   Address Decode(ro::EncodedTagged encoded) const {
     ReadOnlyPageMetadata* page = PageAt(encoded.page_index);
     return page->OffsetToAddress(encoded.offset * kTaggedSize);
@@ -154,6 +212,11 @@ ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
     : Deserializer(isolate, data->Payload(), data->GetMagicNumber(), false,
                    can_rehash) {}
 
+// static
+size_t ReadOnlyDeserializer::mapped_bytes_for_testing() {
+  return mapped_bytes.load(std::memory_order_relaxed);
+}
+
 void ReadOnlyDeserializer::DeserializeIntoIsolate() {
   base::ElapsedTimer timer;
   if (V8_UNLIKELY(v8_flags.profile_deserialization)) timer.Start();
@@ -20,6 +20,11 @@ class ReadOnlyDeserializer final : public Deserializer<Isolate> {
 
   void DeserializeIntoIsolate();
 
+  // The number of bytes of the read-only space which were mapped from the
+  // snapshot file rather than copied, over all isolates of the process. See
+  // --map-read-only-snapshot.
+  V8_EXPORT_PRIVATE static size_t mapped_bytes_for_testing();
+
  private:
   void PostProcessNewObjects();
 };
@@ -31,6 +31,16 @@ enum Bytecode {
   //   ... segment byte stream
   kSegment,
   //
+  // kMappableSegment parameters:
+  //   Uint30 page_index
+  //   Uint30 offset
+  //   Uint30 size_in_bytes
+  //   Uint32 padding_size
+  //   ... padding
+  //   ... segment byte stream, at a payload offset congruent to its address
+  //       modulo kMappableSegmentAlignment
+  kMappableSegment,
+  //
   // kRelocateSegment parameters:
   //   ... relocation byte stream
   kRelocateSegment,
@@ -44,6 +54,14 @@ enum Bytecode {
 static constexpr int kNumberOfBytecodes =
     static_cast<int>(kFinalizeReadOnlySpace) + 1;
 
+// Mappable segments are laid out such that the read-only space can be mapped
+// copy-on-write from a file-backed snapshot (see the
+// --mappable-read-only-snapshot flag). This only works with static roots,
+// where segments need no relocation. The alignment is a multiple of the OS
+// page sizes of all supported targets; the read-only payload is aligned to it
+// in the snapshot blob.
+static constexpr size_t kMappableSegmentAlignment = 64 * KB;
+
 // Like std::vector<bool> but with a known underlying encoding.
 class BitSet final {
  public:
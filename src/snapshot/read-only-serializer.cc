@@ -363,12 +363,28 @@ class ReadOnlyHeapImageSerializer {
   }
 
   void EmitSegment(const ReadOnlySegmentForSerialization* segment) {
-    sink_->Put(Bytecode::kSegment, "segment begin");
+    const bool mappable =
+        V8_STATIC_ROOTS_BOOL && v8_flags.mappable_read_only_snapshot;
+    if (mappable) {
+      sink_->Put(Bytecode::kMappableSegment, "mappable segment begin");
+    } else {
+      sink_->Put(Bytecode::kSegment, "segment begin");
+    }
     sink_->PutUint30(IndexOf(segment->page), "page index");
     sink_->PutUint30(static_cast<uint32_t>(segment->segment_offset),
                      "segment start offset");
     sink_->PutUint30(static_cast<uint32_t>(segment->segment_size),
                      "segment byte size");
+    if (mappable) {
+      // With static roots, the segment ends up at the same address in the
+      // cage, so its contents can be placed at a congruent payload offset.
+      int contents_position = sink_->Position() + kUInt32Size;
+      uint32_t padding_size = static_cast<uint32_t>(
+          (segment->segment_start - contents_position) &
+          (ro::kMappableSegmentAlignment - 1));
+      sink_->PutUint32(padding_size, "padding size");
+      sink_->PutN(static_cast<int>(padding_size), 0, "padding");
+    }
     sink_->PutRaw(segment->contents.get(),
                   static_cast<int>(segment->segment_size), "page");
     if (!V8_STATIC_ROOTS_BOOL) {
@@ -137,6 +137,8 @@ class SerializerReferenceMap {
     return reference;
   }
 
+  int attached_reference_count() const { return attached_reference_index_; }
+
  private:
   IdentityMap<SerializerReference, base::DefaultAllocationPolicy> map_;
   std::unordered_map<void*, SerializerReference> backing_store_map_;
@@ -37,8 +37,8 @@ class SerializerDeserializer : public RootVisitor {
 
   // clang-format off
 #define UNUSED_SERIALIZER_BYTE_CODES(V)                           \
-  /* Free range 0x21..0x2f */                                     \
-          V(0x21) V(0x22) V(0x23) V(0x24) V(0x25) V(0x26) V(0x27) \
+  /* Free range 0x22..0x2f */                                     \
+                  V(0x22) V(0x23) V(0x24) V(0x25) V(0x26) V(0x27) \
   V(0x28) V(0x29) V(0x2a) V(0x2b) V(0x2c) V(0x2d) V(0x2e) V(0x2f) \
   /* Free range 0x30..0x3f */                                     \
   V(0x30) V(0x31) V(0x32) V(0x33) V(0x34) V(0x35) V(0x36) V(0x37) \
@@ -117,6 +117,8 @@ class SerializerDeserializer : public RootVisitor {
     kEmbedderFieldsData,
     // Used for embedder-provided serialziation data for API wrappers.
     kApiWrapperFieldsData,
+    // Used for the separately serialized values of lazy global properties.
+    kLazyPropertiesData,
     // Raw data of variable length.
     kVariableRawData,
     // Used to encode external references provided through the API.
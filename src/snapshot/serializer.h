@@ -322,6 +322,7 @@ class Serializer : public SerializerDeserializer {
 
   SnapshotByteSink sink_;  // Used directly by subclasses.
 
+  Snapshot::SerializerFlags flags() const { return flags_; }
   bool allow_unknown_external_references_for_testing() const {
     return (flags_ & Snapshot::kAllowUnknownExternalReferencesForTesting) != 0;
   }
@@ -4,7 +4,19 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "include/v8-platform.h"
+#include "src/base/memory.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/common/globals.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
+#include "src/tracing/trace-event.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,53 +24,201 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+using Codec = SnapshotCompression::Codec;
+
+uint32_t ReadHeaderValue(const uint8_t* data, uint32_t offset) {
+  return base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(data) + offset);
+}
+
+void WriteHeaderValue(uint8_t* data, uint32_t offset, uint32_t value) {
+  base::WriteLittleEndianValue(reinterpret_cast<Address>(data) + offset,
+                               value);
+}
+
+uint32_t NumberOfChunks(uint32_t uncompressed_size, uint32_t chunk_size) {
+  return uncompressed_size / chunk_size +
+         (uncompressed_size % chunk_size == 0 ? 0 : 1);
+}
+
+// Returns the part of {size} bytes which makes up chunk {index}.
+std::pair<uint32_t, uint32_t> ChunkBounds(uint32_t size, uint32_t chunk_size,
+                                          uint32_t index) {
+  uint32_t start = index * chunk_size;
+  return {start, start + std::min(chunk_size, size - start)};
+}
+
+// Returns an upper bound for the compressed size of {size} bytes.
+uint32_t CompressBound(Codec codec, uint32_t size) {
+  switch (codec) {
+    case Codec::kNone:
+      return size;
+    case Codec::kZlib:
+      return static_cast<uint32_t>(compressBound(static_cast<uLong>(size)));
+  }
+  UNREACHABLE();
+}
+
+// Compresses {input} into {output}, which must be at least as large as
+// CompressBound, and returns the compressed size.
+uint32_t CompressChunk(Codec codec, base::Vector<const uint8_t> input,
+                       uint8_t* output) {
+  switch (codec) {
+    case Codec::kNone:
+      MemCopy(output, input.begin(), input.size());
+      return static_cast<uint32_t>(input.size());
+    case Codec::kZlib: {
+      static_assert(sizeof(Bytef) == 1, "");
+      const uLong input_size = static_cast<uLong>(input.size());
+      uLongf compressed_size = compressBound(input_size);
+      // Raw compression without zlib or gzip headers, the sizes are stored in
+      // the container header.
+      CHECK_EQ(zlib_internal::CompressHelper(
+                   zlib_internal::ZRAW, output, &compressed_size,
+                   reinterpret_cast<const Bytef*>(input.begin()), input_size,
+                   Z_DEFAULT_COMPRESSION, nullptr, nullptr),
+               Z_OK);
+      return static_cast<uint32_t>(compressed_size);
+    }
+  }
+  UNREACHABLE();
+}
+
+void DecompressChunk(Codec codec, base::Vector<const uint8_t> input,
+                     base::Vector<uint8_t> output) {
+  switch (codec) {
+    case Codec::kNone:
+      CHECK_EQ(input.size(), output.size());
+      MemCopy(output.begin(), input.begin(), input.size());
+      return;
+    case Codec::kZlib: {
+      uLongf uncompressed_size = static_cast<uLongf>(output.size());
+      CHECK_EQ(zlib_internal::UncompressHelper(
+                   zlib_internal::ZRAW, output.begin(), &uncompressed_size,
+                   input.begin(), static_cast<uLong>(input.size())),
+               Z_OK);
+      CHECK_EQ(uncompressed_size, output.size());
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+}  // namespace
+
+// Decompresses the chunks of a snapshot, claiming them one at a time, on the
+// joining thread and on as many worker threads as there are chunks left.
+class SnapshotCompression::DecompressionJob final : public JobTask {
+ public:
+  DecompressionJob(Codec codec,
+                   std::vector<base::Vector<const uint8_t>> compressed_chunks,
+                   std::vector<base::Vector<uint8_t>> uncompressed_chunks)
+      : codec_(codec),
+        compressed_chunks_(std::move(compressed_chunks)),
+        uncompressed_chunks_(std::move(uncompressed_chunks)) {
+    DCHECK_EQ(compressed_chunks_.size(), uncompressed_chunks_.size());
+  }
+
+  void Run(JobDelegate* delegate) override {
+    TRACE_EVENT0("v8", "V8.SnapshotDecompressChunks");
+    do {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= compressed_chunks_.size()) return;
+      DecompressChunk(codec_, compressed_chunks_[index],
+                      uncompressed_chunks_[index]);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    if (next_chunk >= compressed_chunks_.size()) return 0;
+    return compressed_chunks_.size() - next_chunk;
+  }
+
+ private:
+  const Codec codec_;
+  const std::vector<base::Vector<const uint8_t>> compressed_chunks_;
+  const std::vector<base::Vector<uint8_t>> uncompressed_chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+// static
+const char* SnapshotCompression::CodecName(Codec codec) {
+  switch (codec) {
+    case Codec::kNone:
+      return "none";
+    case Codec::kZlib:
+      return "zlib";
+  }
+  UNREACHABLE();
+}
+
+// static
+SnapshotCompression::Codec SnapshotCompression::CodecFromFlag() {
+  for (Codec codec : kAllCodecs) {
+    if (strcmp(v8_flags.snapshot_compression_codec, CodecName(codec)) == 0) {
+      return codec;
+    }
+  }
+  FATAL("Unknown snapshot compression codec: %s",
+        v8_flags.snapshot_compression_codec.value());
 }
 
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  if (v8_flags.snapshot_compression_statistics) {
+    PrintStatistics(uncompressed_data);
+  }
+  return Compress(uncompressed_data, CodecFromFlag(),
+                  v8_flags.snapshot_compression_chunk_size);
+}
+
+SnapshotData SnapshotCompression::Compress(
+    const SnapshotData* uncompressed_data, Codec codec, uint32_t chunk_size) {
+  CHECK_LT(0u, chunk_size);
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  const uint32_t uncompressed_size = static_cast<uint32_t>(input.size());
+  const uint32_t num_chunks = NumberOfChunks(uncompressed_size, chunk_size);
+  const uint32_t header_size = kChunkSizesOffset + num_chunks * kUInt32Size;
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
-
-  uint8_t* compressed_data =
-      const_cast<uint8_t*>(snapshot_data.RawData().begin());
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  uint32_t allocation_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    auto [start, end] = ChunkBounds(uncompressed_size, chunk_size, i);
+    allocation_size += CompressBound(codec, end - start);
+  }
+  snapshot_data.AllocateData(allocation_size);
+
+  uint8_t* data = const_cast<uint8_t*>(snapshot_data.RawData().begin());
+  WriteHeaderValue(data, kMagicNumberOffset, kMagicNumber);
+  WriteHeaderValue(data, kCodecOffset, static_cast<uint32_t>(codec));
+  WriteHeaderValue(data, kUncompressedSizeOffset, uncompressed_size);
+  WriteHeaderValue(data, kChunkSizeOffset, chunk_size);
+
+  uint32_t compressed_size = header_size;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    auto [start, end] = ChunkBounds(uncompressed_size, chunk_size, i);
+    uint32_t compressed_chunk_size = CompressChunk(
+        codec, input.SubVector(start, end), data + compressed_size);
+    WriteHeaderValue(data, kChunkSizesOffset + i * kUInt32Size,
+                     compressed_chunk_size);
+    compressed_size += compressed_chunk_size;
+  }
+  DCHECK_LE(compressed_size, allocation_size);
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(compressed_size);
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks with %s took %0.3f ms]\n",
+           uncompressed_size, num_chunks, CodecName(codec), ms);
   }
   return snapshot_data;
 }
@@ -69,32 +229,92 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      reinterpret_cast<const Bytef*>(compressed_data.begin());
+  const uint8_t* data = compressed_data.begin();
+  CHECK_LE(kChunkSizesOffset, compressed_data.size());
+  CHECK_EQ(kMagicNumber, ReadHeaderValue(data, kMagicNumberOffset));
+  const uint32_t raw_codec = ReadHeaderValue(data, kCodecOffset);
+  CHECK_LE(raw_codec, static_cast<uint32_t>(Codec::kZlib));
+  const Codec codec = static_cast<Codec>(raw_codec);
+  const uint32_t uncompressed_size =
+      ReadHeaderValue(data, kUncompressedSizeOffset);
+  const uint32_t chunk_size = ReadHeaderValue(data, kChunkSizeOffset);
+  CHECK_LT(0u, chunk_size);
+  const uint32_t num_chunks = NumberOfChunks(uncompressed_size, chunk_size);
+  const uint32_t header_size = kChunkSizesOffset + num_chunks * kUInt32Size;
+  CHECK_LE(header_size, compressed_data.size());
 
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  snapshot_data.AllocateData(uncompressed_size);
+  uint8_t* output = const_cast<uint8_t*>(snapshot_data.RawData().begin());
 
-  snapshot_data.AllocateData(uncompressed_payload_length);
+  std::vector<base::Vector<const uint8_t>> compressed_chunks;
+  std::vector<base::Vector<uint8_t>> uncompressed_chunks;
+  compressed_chunks.reserve(num_chunks);
+  uncompressed_chunks.reserve(num_chunks);
+  size_t offset = header_size;
+  for (uint32_t i = 0; i < num_chunks; ++i) {
+    uint32_t compressed_chunk_size =
+        ReadHeaderValue(data, kChunkSizesOffset + i * kUInt32Size);
+    CHECK_LE(compressed_chunk_size, compressed_data.size() - offset);
+    compressed_chunks.push_back(
+        compressed_data.SubVector(offset, offset + compressed_chunk_size));
+    offset += compressed_chunk_size;
+    auto [start, end] = ChunkBounds(uncompressed_size, chunk_size, i);
+    uncompressed_chunks.push_back(
+        base::Vector<uint8_t>(output + start, end - start));
+  }
+  CHECK_EQ(offset, compressed_data.size());
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  auto job = std::make_unique<DecompressionJob>(
+      codec, std::move(compressed_chunks), std::move(uncompressed_chunks));
+  if (num_chunks <= 1 || v8_flags.single_threaded) {
+    class NeverYieldDelegate final : public JobDelegate {
+     public:
+      bool ShouldYield() override { return false; }
+      bool IsJoiningThread() const override { return true; }
+      void NotifyConcurrencyIncrease() override {}
+      uint8_t GetTaskId() override { return 0; }
+    };
+    NeverYieldDelegate delegate;
+    job->Run(&delegate);
+  } else {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking, std::move(job))
+        ->Join();
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_size, num_chunks, ms);
   }
   return snapshot_data;
 }
 
+// static
+void SnapshotCompression::PrintStatistics(
+    const SnapshotData* uncompressed_data) {
+  const uint32_t uncompressed_size =
+      static_cast<uint32_t>(uncompressed_data->RawData().size());
+  for (Codec codec : kAllCodecs) {
+    base::ElapsedTimer timer;
+    timer.Start();
+    SnapshotData compressed = Compress(
+        uncompressed_data, codec, v8_flags.snapshot_compression_chunk_size);
+    double compress_ms = timer.Elapsed().InMillisecondsF();
+    timer.Restart();
+    SnapshotData decompressed = Decompress(compressed.RawData());
+    double decompress_ms = timer.Elapsed().InMillisecondsF();
+    CHECK_EQ(uncompressed_data->RawData(), decompressed.RawData());
+    size_t compressed_size = compressed.RawData().size();
+    PrintF(
+        "[Snapshot compression with %s: %u -> %zu bytes (%.1f%%), compressed "
+        "in %0.3f ms, decompressed in %0.3f ms]\n",
+        CodecName(codec), uncompressed_size, compressed_size,
+        uncompressed_size == 0 ? 100.0
+                               : 100.0 * compressed_size / uncompressed_size,
+        compress_ms, decompress_ms);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
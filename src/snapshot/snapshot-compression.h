@@ -11,12 +11,49 @@
 namespace v8 {
 namespace internal {
 
+// Compressed snapshots are split into chunks which are compressed
+// independently, so that they can be decompressed in parallel. The container
+// consists of uint32_t-sized header entries followed by the chunks:
+// [0] magic number
+// [1] codec
+// [2] uncompressed size
+// [3] uncompressed size of every chunk but the last one
+// [4 + i] compressed size of chunk i
+// ... compressed chunks
 class SnapshotCompression : public AllStatic {
  public:
+  enum class Codec : uint32_t {
+    kNone = 0,
+    kZlib = 1,
+  };
+  static constexpr Codec kAllCodecs[] = {Codec::kNone, Codec::kZlib};
+
+  static const char* CodecName(Codec codec);
+
+  // Compresses with the codec and chunk size given by
+  // --snapshot-compression-codec and --snapshot-compression-chunk-size.
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      const SnapshotData* uncompressed_data, Codec codec, uint32_t chunk_size);
+  // Decompresses the chunks on worker threads, unless there is only one.
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       base::Vector<const uint8_t> compressed_data);
+
+ private:
+  static constexpr uint32_t kMagicNumber = 0xC0DE5A00;
+  static constexpr uint32_t kMagicNumberOffset = 0;
+  static constexpr uint32_t kCodecOffset = kMagicNumberOffset + kUInt32Size;
+  static constexpr uint32_t kUncompressedSizeOffset =
+      kCodecOffset + kUInt32Size;
+  static constexpr uint32_t kChunkSizeOffset =
+      kUncompressedSizeOffset + kUInt32Size;
+  static constexpr uint32_t kChunkSizesOffset = kChunkSizeOffset + kUInt32Size;
+
+  class DecompressionJob;
+
+  static Codec CodecFromFlag();
+  static void PrintStatistics(const SnapshotData* uncompressed_data);
 };
 
 }  // namespace internal
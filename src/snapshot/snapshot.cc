@@ -6,8 +6,11 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <optional>
+
 #include "src/api/api-inl.h"  // For OpenHandle.
 #include "src/baseline/baseline-batch-compiler.h"
+#include "src/builtins/accessors.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/local-isolate-inl.h"
 #include "src/handles/global-handles-inl.h"
@@ -18,8 +21,10 @@
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/lookup-inl.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
+#include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/read-only-serializer.h"
 #include "src/snapshot/shared-heap-serializer.h"
 #include "src/snapshot/snapshot-utils.h"
@@ -78,11 +83,13 @@ class SnapshotImpl : public AllStatic {
   // [4] (64 bytes) version string
   // [5] offset to readonly
   // [6] offset to shared heap
-  // [7] offset to context 0
-  // [8] offset to context 1
+  // [7] size of the padding in front of the read-only snapshot data
+  // [8] offset to context 0
+  // [9] offset to context 1
   // ...
   // ... offset to context N - 1
   // ... startup snapshot data
+  // ... padding, see ro::kMappableSegmentAlignment
   // ... read-only snapshot data
   // ... shared heap snapshot data
   // ... context 0 snapshot data
@@ -102,8 +109,10 @@ class SnapshotImpl : public AllStatic {
       kVersionStringOffset + kVersionStringLength;
   static const uint32_t kSharedHeapOffsetOffset =
       kReadOnlyOffsetOffset + kUInt32Size;
-  static const uint32_t kFirstContextOffsetOffset =
+  static const uint32_t kReadOnlyPaddingOffset =
       kSharedHeapOffsetOffset + kUInt32Size;
+  static const uint32_t kFirstContextOffsetOffset =
+      kReadOnlyPaddingOffset + kUInt32Size;
 
   static base::Vector<const uint8_t> ChecksummedContent(
       const v8::StartupData* data) {
@@ -145,6 +154,35 @@ SnapshotData MaybeDecompress(Isolate* isolate,
 #endif
 }
 
+namespace {
+
+// Returns the data of the given context snapshot. If the isolate caches
+// decompressed context snapshots, it is only decompressed for the first context
+// created from it, otherwise it is decompressed into {uncached_data}.
+const SnapshotData* GetContextSnapshotData(
+    Isolate* isolate, uint32_t context_index,
+    std::optional<SnapshotData>* uncached_data) {
+  base::Vector<const uint8_t> context_data =
+      SnapshotImpl::ExtractContextData(isolate->snapshot_blob(), context_index);
+#ifdef V8_SNAPSHOT_COMPRESSION
+  if (isolate->cache_decompressed_context_snapshots()) {
+    std::vector<std::unique_ptr<SnapshotData>>* cache =
+        isolate->decompressed_context_snapshot_cache();
+    if (cache->size() <= context_index) cache->resize(context_index + 1);
+    std::unique_ptr<SnapshotData>& cached_data = cache->at(context_index);
+    if (!cached_data) {
+      cached_data = std::make_unique<SnapshotData>(
+          MaybeDecompress(isolate, context_data));
+    }
+    return cached_data.get();
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+  uncached_data->emplace(MaybeDecompress(isolate, context_data));
+  return &uncached_data->value();
+}
+
+}  // namespace
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -207,15 +245,70 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   bool can_rehash = ExtractRehashability(blob);
-  base::Vector<const uint8_t> context_data = SnapshotImpl::ExtractContextData(
-      blob, static_cast<uint32_t>(context_index));
-  SnapshotData snapshot_data(MaybeDecompress(isolate, context_data));
+  std::optional<SnapshotData> uncached_data;
+  const SnapshotData* snapshot_data = GetContextSnapshotData(
+      isolate, static_cast<uint32_t>(context_index), &uncached_data);
 
   return ContextDeserializer::DeserializeContext(
-      isolate, &snapshot_data, context_index, can_rehash, global_proxy,
+      isolate, snapshot_data, context_index, can_rehash, global_proxy,
       embedder_fields_deserializer);
 }
 
+// static
+void Snapshot::MaterializeLazyContextProperties(
+    Isolate* isolate, DirectHandle<NativeContext> native_context) {
+  if (!IsFixedArray(native_context->lazy_snapshot_properties())) return;
+  HandleScope scope(isolate);
+  DirectHandle<FixedArray> lazy_properties(
+      Cast<FixedArray>(native_context->lazy_snapshot_properties()), isolate);
+  native_context->set_lazy_snapshot_properties(
+      ReadOnlyRoots(isolate).undefined_value());
+
+  DirectHandle<FixedArray> values;
+  if (IsFixedArray(lazy_properties->get(kLazyPropertiesValuesIndex))) {
+    // The context has not been serialized yet.
+    values = direct_handle(
+        Cast<FixedArray>(lazy_properties->get(kLazyPropertiesValuesIndex)),
+        isolate);
+  } else {
+    const v8::StartupData* blob = isolate->snapshot_blob();
+    CHECK_NOT_NULL(blob);
+    size_t context_index = static_cast<size_t>(
+        Smi::ToInt(lazy_properties->get(kLazyPropertiesContextIndexIndex)));
+    std::optional<SnapshotData> uncached_data;
+    const SnapshotData* snapshot_data = GetContextSnapshotData(
+        isolate, static_cast<uint32_t>(context_index), &uncached_data);
+    values = ContextDeserializer::DeserializeLazyProperties(
+        isolate, snapshot_data, context_index, ExtractRehashability(blob),
+        Smi::ToInt(lazy_properties->get(kLazyPropertiesDataOffsetIndex)),
+        Smi::ToInt(lazy_properties->get(kLazyPropertiesDataLengthIndex)),
+        direct_handle(Cast<FixedArray>(lazy_properties->get(
+                          kLazyPropertiesAttachedObjectsIndex)),
+                      isolate));
+  }
+
+  Handle<JSGlobalObject> global(native_context->global_object(), isolate);
+  DirectHandle<FixedArray> names(
+      Cast<FixedArray>(lazy_properties->get(kLazyPropertiesNamesIndex)),
+      isolate);
+  CHECK_EQ(names->length(), values->length());
+  for (int i = 0; i < names->length(); i++) {
+    Handle<Name> name(Cast<Name>(names->get(i)), isolate);
+    LookupIterator it(isolate, global, name, global,
+                      LookupIterator::OWN_SKIP_INTERCEPTOR);
+    // Leave properties alone that have been redefined in the meantime.
+    if (it.state() != LookupIterator::ACCESSOR) continue;
+    DirectHandle<Object> accessors = it.GetAccessors();
+    if (!IsAccessorInfo(*accessors) ||
+        Cast<AccessorInfo>(*accessors)->getter(isolate) !=
+            reinterpret_cast<Address>(&Accessors::LazyContextPropertyGetter)) {
+      continue;
+    }
+    it.ReconfigureDataProperty(handle(values->get(i), isolate),
+                               it.property_attributes());
+  }
+}
+
 // static
 void Snapshot::ClearReconstructableDataForSerialization(
     Isolate* isolate, bool clear_recompilable_data) {
@@ -540,6 +633,22 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
       SnapshotImpl::StartupSnapshotOffset(num_contexts);
   uint32_t total_length = startup_snapshot_offset;
   total_length += static_cast<uint32_t>(startup_snapshot->RawData().length());
+  // The payload of a mappable read-only snapshot is aligned in the blob, such
+  // that its segments are congruent to their addresses in the read-only space.
+  uint32_t read_only_padding = 0;
+#ifndef V8_SNAPSHOT_COMPRESSION
+  if (V8_STATIC_ROOTS_BOOL && v8_flags.mappable_read_only_snapshot) {
+    uint32_t read_only_payload_start =
+        total_length +
+        static_cast<uint32_t>(read_only_snapshot->Payload().begin() -
+                              read_only_snapshot->RawData().begin());
+    read_only_padding =
+        RoundUp(read_only_payload_start,
+                static_cast<uint32_t>(ro::kMappableSegmentAlignment)) -
+        read_only_payload_start;
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+  total_length += read_only_padding;
   total_length += static_cast<uint32_t>(read_only_snapshot->RawData().length());
   total_length +=
       static_cast<uint32_t>(shared_heap_snapshot->RawData().length());
@@ -555,6 +664,8 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
                                num_contexts);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kRehashabilityOffset,
                                can_be_rehashed ? 1 : 0);
+  SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kReadOnlyPaddingOffset,
+                               read_only_padding);
 
   // Write version string into snapshot data.
   memset(data + SnapshotImpl::kVersionStringOffset, 0,
@@ -576,6 +687,8 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
     PrintF("%10d bytes for startup\n", payload_length);
   }
   payload_offset += payload_length;
+  memset(data + payload_offset, 0, read_only_padding);
+  payload_offset += read_only_padding;
 
   // Read-only.
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kReadOnlyOffsetOffset,
@@ -704,7 +817,8 @@ base::Vector<const uint8_t> SnapshotImpl::ExtractStartupData(
 
   uint32_t num_contexts = ExtractNumContexts(data);
   return ExtractData(data, StartupSnapshotOffset(num_contexts),
-                     GetHeaderValue(data, kReadOnlyOffsetOffset));
+                     GetHeaderValue(data, kReadOnlyOffsetOffset) -
+                         GetHeaderValue(data, kReadOnlyPaddingOffset));
 }
 
 base::Vector<const uint8_t> SnapshotImpl::ExtractReadOnlyData(
@@ -1042,6 +1156,58 @@ void ConvertSerializedObjectsToFixedArray(Isolate* isolate,
 
 }  // anonymous namespace
 
+// static
+void Snapshot::PrepareLazyContextProperties(
+    Isolate* isolate, DirectHandle<NativeContext> native_context) {
+  const char* flag = v8_flags.lazy_context_snapshot_properties;
+  if (flag == nullptr || *flag == '\0') return;
+
+  Factory* factory = isolate->factory();
+  Handle<JSGlobalObject> global(native_context->global_object(), isolate);
+  std::vector<Handle<Name>> names;
+  std::vector<Handle<Object>> values;
+  for (const char* start = flag; *start != '\0';) {
+    const char* end = strchr(start, ',');
+    if (end == nullptr) end = start + strlen(start);
+    if (end != start) {
+      Handle<String> name = factory->InternalizeUtf8String(
+          base::Vector<const char>(start, end - start));
+      LookupIterator it(isolate, global, name, global,
+                        LookupIterator::OWN_SKIP_INTERCEPTOR);
+      // Only configurable data properties holding objects can be replaced.
+      if (it.state() == LookupIterator::DATA && it.IsConfigurable()) {
+        Handle<Object> value = it.GetDataValue();
+        if (IsJSReceiver(*value)) {
+          it.TransitionToAccessorPair(
+              Accessors::MakeAccessor(isolate, name,
+                                      &Accessors::LazyContextPropertyGetter,
+                                      &Accessors::ReconfigureToDataProperty),
+              it.property_attributes());
+          names.push_back(name);
+          values.push_back(value);
+        }
+      }
+    }
+    start = *end == ',' ? end + 1 : end;
+  }
+  if (names.empty()) return;
+
+  const int count = static_cast<int>(names.size());
+  DirectHandle<FixedArray> names_array =
+      factory->NewFixedArray(count, AllocationType::kOld);
+  DirectHandle<FixedArray> values_array =
+      factory->NewFixedArray(count, AllocationType::kOld);
+  for (int i = 0; i < count; i++) {
+    names_array->set(i, *names[i]);
+    values_array->set(i, *values[i]);
+  }
+  DirectHandle<FixedArray> lazy_properties =
+      factory->NewFixedArray(kLazyPropertiesLength, AllocationType::kOld);
+  lazy_properties->set(kLazyPropertiesNamesIndex, *names_array);
+  lazy_properties->set(kLazyPropertiesValuesIndex, *values_array);
+  native_context->set_lazy_snapshot_properties(*lazy_properties);
+}
+
 // static
 StartupData SnapshotCreatorImpl::CreateBlob(
     SnapshotCreator::FunctionCodeHandling function_code_handling,
@@ -1065,6 +1231,15 @@ StartupData SnapshotCreatorImpl::CreateBlob(
       ConvertSerializedObjectsToFixedArray(isolate_, context_at(i));
     }
 
+    // Split off the values of rarely used global object properties, which
+    // are deserialized on first access. Contexts that were themselves created
+    // from a snapshot may still have placeholders whose values live in the
+    // old blob, so those values are deserialized first.
+    for (size_t i = 0; i < num_contexts; i++) {
+      Snapshot::MaterializeLazyContextProperties(isolate_, context_at(i));
+      Snapshot::PrepareLazyContextProperties(isolate_, context_at(i));
+    }
+
     // We need to store the global proxy size upfront in case we need the
     // bootstrapper to create a global proxy before we deserialize the context.
     DirectHandle<FixedArray> global_proxy_sizes =
@@ -19,6 +19,7 @@ namespace internal {
 class Context;
 class Isolate;
 class JSGlobalProxy;
+class NativeContext;
 class SafepointScope;
 class SnapshotData;
 
@@ -75,6 +76,30 @@ class Snapshot : public AllStatic {
       const DisallowGarbageCollection& no_gc,
       SerializerFlags flags = kDefaultSerializerFlags);
 
+  // Replaces the global object properties named in
+  // --lazy-context-snapshot-properties with placeholder accessors, so that the
+  // context serializer writes their values into a separate section which is
+  // only deserialized when one of them is first accessed.
+  static void PrepareLazyContextProperties(
+      Isolate* isolate, DirectHandle<NativeContext> native_context);
+
+  // Layout of NativeContext::lazy_snapshot_properties().
+  enum LazyContextPropertiesSlot {
+    // Names of the properties that are still backed by placeholder accessors.
+    kLazyPropertiesNamesIndex,
+    // Their values, which are only present while the context has not been
+    // serialized yet.
+    kLazyPropertiesValuesIndex,
+    // Objects of the context snapshot that are referenced from the values.
+    kLazyPropertiesAttachedObjectsIndex,
+    // Index of the context snapshot and location of the serialized values in
+    // its payload.
+    kLazyPropertiesContextIndexIndex,
+    kLazyPropertiesDataOffsetIndex,
+    kLazyPropertiesDataLengthIndex,
+    kLazyPropertiesLength,
+  };
+
   // ---------------- Deserialization -----------------------------------------
 
   // Initialize the Isolate from the internal snapshot. Returns false if no
@@ -87,6 +112,11 @@ class Snapshot : public AllStatic {
       size_t context_index,
       DeserializeEmbedderFieldsCallback embedder_fields_deserializer);
 
+  // Deserializes the values of the lazy global object properties of the given
+  // context and turns their placeholder accessors into data properties.
+  V8_EXPORT_PRIVATE static void MaterializeLazyContextProperties(
+      Isolate* isolate, DirectHandle<NativeContext> native_context);
+
   // ---------------- Testing -------------------------------------------------
 
   // This function is used to stress the snapshot component. It serializes the
@@ -29,6 +29,7 @@
 #include "src/wasm/std-object-sizes.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-disk-cache.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-feature-flags.h"
 #include "src/wasm/wasm-import-wrapper-cache.h"
@@ -2421,8 +2422,8 @@ AsyncCompileJob::AsyncCompileJob(
 }
 
 void AsyncCompileJob::Start() {
-  DoAsync<DecodeModule>(isolate_->counters(),
-                        isolate_->metrics_recorder());  // --
+  DoAsync<DecodeModule>(isolate_->counters(), isolate_->metrics_recorder(),
+                        GetWasmEngine()->disk_cache());  // --
 }
 
 void AsyncCompileJob::Abort() {
@@ -2589,6 +2590,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void OnAbort() override;
 
+  void OnFinishedBufferedStream(
+      base::OwnedVector<const uint8_t> bytes) override;
+
   bool Deserialize(base::Vector<const uint8_t> wire_bytes,
                    base::Vector<const uint8_t> module_bytes) override;
 
@@ -2681,6 +2685,66 @@ void AsyncCompileJob::PrepareRuntimeObjects() {
   module_object_ = isolate_->global_handles()->Create(*module_object);
 }
 
+namespace {
+
+// Serializes a module and stores it in the disk cache. This runs on a worker
+// thread, since serializing and writing a large module can take a while.
+class StoreInDiskCacheTask : public v8::Task {
+ public:
+  StoreInDiskCacheTask(std::weak_ptr<NativeModule> native_module,
+                       std::shared_ptr<WasmDiskCache> disk_cache)
+      : native_module_(std::move(native_module)),
+        disk_cache_(std::move(disk_cache)) {}
+
+  void Run() override {
+    std::shared_ptr<NativeModule> native_module = native_module_.lock();
+    if (!native_module) return;
+    TRACE_EVENT0("v8.wasm", "wasm.StoreInDiskCache");
+    WasmSerializer serializer(native_module.get());
+    auto buffer = base::OwnedVector<uint8_t>::NewForOverwrite(
+        serializer.GetSerializedNativeModuleSize());
+    if (!serializer.SerializeNativeModule(buffer.as_vector())) return;
+    disk_cache_->Store(native_module->wire_bytes(), buffer.as_vector());
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+  const std::shared_ptr<WasmDiskCache> disk_cache_;
+};
+
+// Stores the module in the disk cache whenever more of its functions can be
+// serialized, i.e. on the same events that embedders use for caching.
+class StoreInDiskCacheCallback : public CompilationEventCallback {
+ public:
+  StoreInDiskCacheCallback(std::weak_ptr<NativeModule> native_module,
+                           std::shared_ptr<WasmDiskCache> disk_cache,
+                           bool dynamic_tiering)
+      : native_module_(std::move(native_module)),
+        disk_cache_(std::move(disk_cache)),
+        // Without dynamic tiering, baseline compilation already produces the
+        // final code.
+        store_event_(dynamic_tiering
+                         ? CompilationEvent::kFinishedCompilationChunk
+                         : CompilationEvent::kFinishedBaselineCompilation) {}
+
+  void call(CompilationEvent event) override {
+    if (event != store_event_) return;
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<StoreInDiskCacheTask>(native_module_, disk_cache_));
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return kKeepAfterFinalEvent;
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+  const std::shared_ptr<WasmDiskCache> disk_cache_;
+  const CompilationEvent store_event_;
+};
+
+}  // namespace
+
 // This function assumes that it is executed in a HandleScope, and that a
 // context is set on the isolate.
 void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
@@ -2712,6 +2776,17 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
     PrepareRuntimeObjects();
   }
 
+  // Modules that came from a cache are already stored on disk, or are being
+  // stored by the job that compiled them.
+  if (!is_after_cache_hit && !is_after_deserialization) {
+    if (std::shared_ptr<WasmDiskCache> disk_cache =
+            GetWasmEngine()->disk_cache()) {
+      compilation_state->AddCallback(std::make_unique<StoreInDiskCacheCallback>(
+          native_module_, std::move(disk_cache),
+          compilation_state->dynamic_tiering()));
+    }
+  }
+
   // Measure duration of baseline compilation or deserialization from cache.
   if (base::TimeTicks::IsHighResolution()) {
     base::TimeDelta duration = base::TimeTicks::Now() - start_time_;
@@ -2983,11 +3058,15 @@ void AsyncCompileJob::NextStep(Args&&... args) {
 //==========================================================================
 class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
  public:
-  explicit DecodeModule(Counters* counters,
-                        std::shared_ptr<metrics::Recorder> metrics_recorder)
-      : counters_(counters), metrics_recorder_(std::move(metrics_recorder)) {}
+  DecodeModule(Counters* counters,
+               std::shared_ptr<metrics::Recorder> metrics_recorder,
+               std::shared_ptr<WasmDiskCache> disk_cache)
+      : counters_(counters),
+        metrics_recorder_(std::move(metrics_recorder)),
+        disk_cache_(std::move(disk_cache)) {}
 
   void RunInBackground(AsyncCompileJob* job) override {
+    if (disk_cache_ && LookUpInDiskCache(job)) return;
     ModuleResult result;
     {
       DisallowHandleAllocation no_handle;
@@ -3037,8 +3116,128 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
   }
 
  private:
+  // Continues with deserializing the module if it is in the disk cache.
+  // Returns false if the module has to be compiled instead.
+  bool LookUpInDiskCache(AsyncCompileJob* job) {
+    TRACE_EVENT0("v8.wasm", "wasm.LookUpInDiskCache");
+    base::OwnedVector<const uint8_t> serialized_module =
+        disk_cache_->Lookup(job->wire_bytes_.module_bytes());
+    if (!IsSupportedVersion(serialized_module.as_vector(),
+                            job->enabled_features_)) {
+      return false;
+    }
+    ModuleResult result;
+    {
+      DisallowHandleAllocation no_handle;
+      DisallowGarbageCollection no_gc;
+      TRACE_COMPILE("(1) Decoding module for deserialization...\n");
+      result = DecodeWasmModule(
+          job->enabled_features_, job->wire_bytes_.module_bytes(), false,
+          kWasmOrigin, counters_, metrics_recorder_, job->context_id(),
+          DecodingMethod::kDeserialize, &job->detected_features_);
+      if (result.ok()) {
+        const WasmModule* module = result.value().get();
+        if (WasmError error = ValidateAndSetBuiltinImports(
+                module, job->wire_bytes_.module_bytes(), job->compile_imports_,
+                &job->detected_features_)) {
+          result = ModuleResult{std::move(error)};
+        }
+      }
+    }
+    // Let the compilation report any errors.
+    if (result.failed()) return false;
+    job->DoSync<PrepareDeserialization>(std::move(result).value(),
+                                        std::move(serialized_module));
+    return true;
+  }
+
   Counters* const counters_;
   std::shared_ptr<metrics::Recorder> metrics_recorder_;
+  const std::shared_ptr<WasmDiskCache> disk_cache_;
+};
+
+//==========================================================================
+// Step 1a (sync): Create the native module for a module from the disk cache.
+//==========================================================================
+class AsyncCompileJob::PrepareDeserialization : public CompileStep {
+ public:
+  PrepareDeserialization(std::shared_ptr<const WasmModule> module,
+                         base::OwnedVector<const uint8_t> serialized_module)
+      : module_(std::move(module)),
+        serialized_module_(std::move(serialized_module)) {}
+
+ private:
+  void RunInForeground(AsyncCompileJob* job) override {
+    TRACE_COMPILE("(1a) Prepare deserialization...\n");
+    // Like {DeserializeNativeModule}, reserve space for the code that was
+    // serialized, which includes Liftoff code only with dynamic tiering.
+    const bool include_liftoff = !job->dynamic_tiering_;
+    size_t code_size_estimate =
+        wasm::WasmCodeManager::EstimateNativeModuleCodeSize(
+            module_.get(), include_liftoff, job->dynamic_tiering_);
+    if (job->GetOrCreateNativeModule(std::move(module_), code_size_estimate)) {
+      job->FinishCompile(true);
+      return;
+    }
+    job->DoAsync<DeserializeModule>(std::move(serialized_module_));
+  }
+
+  std::shared_ptr<const WasmModule> module_;
+  base::OwnedVector<const uint8_t> serialized_module_;
+};
+
+//==========================================================================
+// Step 1b (async): Deserialize the code of the native module.
+//==========================================================================
+class AsyncCompileJob::DeserializeModule : public CompileStep {
+ public:
+  explicit DeserializeModule(base::OwnedVector<const uint8_t> serialized_module)
+      : serialized_module_(std::move(serialized_module)) {}
+
+ private:
+  void RunInBackground(AsyncCompileJob* job) override {
+    TRACE_COMPILE("(1b) Deserializing module...\n");
+    TRACE_EVENT0("v8.wasm", "wasm.Deserialize");
+    bool success = DeserializeNativeModuleCode(job->native_module_.get(),
+                                               serialized_module_.as_vector());
+    job->DoSync<FinishDeserialization>(success);
+  }
+
+  const base::OwnedVector<const uint8_t> serialized_module_;
+};
+
+//==========================================================================
+// Step 1c (sync): Install the deserialized native module.
+//==========================================================================
+class AsyncCompileJob::FinishDeserialization : public CompileStep {
+ public:
+  explicit FinishDeserialization(bool success) : success_(success) {}
+
+ private:
+  void RunInForeground(AsyncCompileJob* job) override {
+    TRACE_COMPILE("(1c) Finish deserialization...\n");
+    if (success_) {
+      // Install the native module in the cache, or reuse a conflicting one.
+      job->native_module_ = GetWasmEngine()->UpdateNativeModuleCache(
+          false, job->native_module_, job->isolate_);
+      job->FinishCompile(true);
+      return;
+    }
+
+    // Drop the native module and compile the wire bytes instead. They were
+    // moved into the native module on its creation, so copy them back.
+    GetWasmEngine()->UpdateNativeModuleCache(true, job->native_module_,
+                                             job->isolate_);
+    job->bytes_copy_ =
+        base::OwnedVector<const uint8_t>::Of(job->native_module_->wire_bytes());
+    job->wire_bytes_ = ModuleWireBytes(job->bytes_copy_.as_vector());
+    job->compile_imports_ = job->native_module_->compile_imports();
+    job->native_module_.reset();
+    job->DoAsync<DecodeModule>(job->isolate_->counters(),
+                               job->isolate_->metrics_recorder(), nullptr);
+  }
+
+  const bool success_;
 };
 
 //==========================================================================
@@ -3486,6 +3685,16 @@ void AsyncStreamingProcessor::OnAbort() {
   job_->Abort();
 }
 
+void AsyncStreamingProcessor::OnFinishedBufferedStream(
+    base::OwnedVector<const uint8_t> bytes) {
+  TRACE_STREAMING("Finish buffered stream...\n");
+  job_->wire_bytes_ = ModuleWireBytes(bytes.as_vector());
+  job_->bytes_copy_ = std::move(bytes);
+  // Continue as an asynchronous, non-streaming compilation, which looks up the
+  // module in the disk cache on a background thread.
+  job_->Start();
+}
+
 bool AsyncStreamingProcessor::Deserialize(
     base::Vector<const uint8_t> module_bytes,
     base::Vector<const uint8_t> wire_bytes) {
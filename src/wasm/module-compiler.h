@@ -140,10 +140,27 @@ class AsyncCompileJob {
 
   // States of the AsyncCompileJob.
   // Step 1 (async). Decodes the wasm module.
+  // --> PrepareDeserialization if the module is in the disk cache,
   // --> Fail on decoding failure,
   // --> PrepareAndStartCompile on success.
   class DecodeModule;
 
+  // Step 1a (sync). Creates the native module for a module found in the disk
+  // cache.
+  // --> finish directly on native module cache hit,
+  // --> DeserializeModule otherwise.
+  class PrepareDeserialization;
+
+  // Step 1b (async). Deserializes the code of the native module.
+  // --> FinishDeserialization.
+  class DeserializeModule;
+
+  // Step 1c (sync). Installs the deserialized native module in the native
+  // module cache.
+  // --> finish directly on success,
+  // --> DecodeModule without the disk cache if deserialization failed.
+  class FinishDeserialization;
+
   // Step 2 (sync). Prepares runtime objects and starts background compilation.
   // --> finish directly on native module cache hit,
   // --> finish directly on validation error,
@@ -11,6 +11,8 @@
 #include "src/wasm/leb-helper.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
+#include "src/wasm/wasm-disk-cache.h"
+#include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects.h"
 #include "src/wasm/wasm-result.h"
@@ -227,6 +229,10 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   // TODO(clemensb): Avoid holding the wire bytes live twice (here and in the
   // section buffers).
   std::vector<std::vector<uint8_t>> full_wire_bytes_{{}};
+
+  // If set, the module is looked up in the disk cache once all wire bytes
+  // arrived, which requires buffering them like for {deserializing()}.
+  std::shared_ptr<WasmDiskCache> disk_cache_;
 };
 
 void AsyncStreamingDecoder::OnBytesReceived(base::Vector<const uint8_t> bytes) {
@@ -252,7 +258,7 @@ void AsyncStreamingDecoder::OnBytesReceived(base::Vector<const uint8_t> bytes) {
                                    bytes.end());
   }
 
-  if (deserializing()) return;
+  if (deserializing() || disk_cache_) return;
 
   TRACE_STREAMING("OnBytesReceived(%zu bytes)\n", bytes.size());
 
@@ -308,19 +314,29 @@ void AsyncStreamingDecoder::Finish(bool can_use_compiled_module) {
     bytes_copy = std::move(all_bytes);
   }
 
-  if (ok() && deserializing()) {
+  if (ok() && (deserializing() || disk_cache_)) {
     // Try to deserialize the module from wire bytes and module bytes.
-    if (can_use_compiled_module &&
+    if (can_use_compiled_module && deserializing() &&
         processor_->Deserialize(compiled_module_bytes_,
                                 base::VectorOf(bytes_copy))) {
       return;
     }
 
+    // Otherwise let the processor look up the module in the disk cache. This
+    // happens off the main thread, so hand over all wire bytes at once. Like
+    // below, reset {processor_} so that there are no further callbacks.
+    if (can_use_compiled_module && disk_cache_) {
+      std::unique_ptr<StreamingProcessor> processor = std::move(processor_);
+      processor->OnFinishedBufferedStream(std::move(bytes_copy));
+      return;
+    }
+
     // Compiled module bytes are invalidated by can_use_compiled_module = false
     // or the deserialization failed. Restart decoding using |bytes_copy|.
     // Reset {full_wire_bytes} to a single empty vector.
     full_wire_bytes_.assign({{}});
     compiled_module_bytes_ = {};
+    disk_cache_.reset();
     DCHECK(!deserializing());
     OnBytesReceived(base::VectorOf(bytes_copy));
     // The decoder has received all wire bytes; fall through and finish.
@@ -756,7 +772,8 @@ AsyncStreamingDecoder::AsyncStreamingDecoder(
     std::unique_ptr<StreamingProcessor> processor)
     : processor_(std::move(processor)),
       // A module always starts with a module header.
-      state_(new DecodeModuleHeader()) {}
+      state_(new DecodeModuleHeader()),
+      disk_cache_(GetWasmEngine()->disk_cache()) {}
 
 AsyncStreamingDecoder::SectionBuffer* AsyncStreamingDecoder::CreateNewBuffer(
     uint32_t module_offset, uint8_t section_id, size_t length,
@@ -57,6 +57,11 @@ class V8_EXPORT_PRIVATE StreamingProcessor {
                                 bool after_error) = 0;
   // Report the abortion of the stream.
   virtual void OnAbort() = 0;
+  // Report the end of a stream that was buffered instead of decoded, and
+  // compile the module from {bytes} like in non-streaming compilation. This is
+  // used when modules are looked up in the disk cache.
+  virtual void OnFinishedBufferedStream(
+      base::OwnedVector<const uint8_t> bytes) = 0;
 
   // Attempt to deserialize the module. Supports embedder caching.
   virtual bool Deserialize(base::Vector<const uint8_t> module_bytes,
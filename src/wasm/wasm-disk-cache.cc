@@ -0,0 +1,193 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-disk-cache.h"
+
+#include <cinttypes>
+#include <cstdio>
+
+#include "src/base/memory.h"
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
+#include "src/base/strings.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/version.h"
+#include "src/wasm/wasm-module.h"
+
+namespace v8::internal::wasm {
+
+namespace {
+
+constexpr char kIndexFileName[] = "index";
+
+uint32_t ReadHeaderValue(const uint8_t* header, int offset) {
+  return base::ReadLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(header + offset));
+}
+
+void WriteHeaderValue(uint8_t* header, int offset, uint32_t value) {
+  base::WriteLittleEndianValue<uint32_t>(
+      reinterpret_cast<Address>(header + offset), value);
+}
+
+bool ReadFully(FILE* file, uint8_t* buffer, size_t size) {
+  for (size_t read = 0; read < size;) {
+    size_t bytes = fread(buffer + read, 1, size - read, file);
+    if (bytes == 0) return false;
+    read += bytes;
+  }
+  return true;
+}
+
+// Replaces the file at {path} by the one at {temporary_path}. On failure, the
+// temporary file is removed.
+bool ReplaceFile(const std::string& temporary_path, const std::string& path) {
+#if V8_OS_WIN
+  // Unlike POSIX, Windows does not replace an existing file on rename.
+  base::OS::Remove(path.c_str());
+#endif  // V8_OS_WIN
+  if (std::rename(temporary_path.c_str(), path.c_str()) == 0) return true;
+  base::OS::Remove(temporary_path.c_str());
+  return false;
+}
+
+}  // namespace
+
+WasmDiskCache::WasmDiskCache(std::string directory, size_t max_size)
+    : directory_(std::move(directory)), max_size_(max_size) {}
+
+std::string WasmDiskCache::EntryFileName(
+    base::Vector<const uint8_t> wire_bytes) const {
+  uint64_t hash = static_cast<uint64_t>(GetWireBytesHash(wire_bytes));
+  base::EmbeddedVector<char, 48> file_name;
+  base::SNPrintF(file_name, "wasm-%016" PRIx64 "-%08zx", hash,
+                 wire_bytes.size());
+  return std::string(file_name.begin());
+}
+
+std::string WasmDiskCache::PathOf(const std::string& file_name) const {
+  return directory_ + "/" + file_name;
+}
+
+std::string WasmDiskCache::TemporaryPath(const std::string& file_name) {
+  base::EmbeddedVector<char, 32> suffix;
+  base::SNPrintF(suffix, ".%d-%u.tmp", base::OS::GetCurrentProcessId(),
+                 next_temporary_id_.fetch_add(1));
+  return PathOf(file_name) + suffix.begin();
+}
+
+base::OwnedVector<const uint8_t> WasmDiskCache::Lookup(
+    base::Vector<const uint8_t> wire_bytes) {
+  std::string path = PathOf(EntryFileName(wire_bytes));
+  FILE* file = base::OS::FOpen(path.c_str(), "rb");
+  if (file == nullptr) return {};
+
+  uint8_t header[kHeaderSize];
+  base::OwnedVector<uint8_t> payload;
+  bool valid =
+      ReadFully(file, header, kHeaderSize) &&
+      ReadHeaderValue(header, kMagicNumberOffset) == kMagicNumber &&
+      ReadHeaderValue(header, kVersionHashOffset) == Version::Hash() &&
+      ReadHeaderValue(header, kWireBytesLengthOffset) == wire_bytes.size() &&
+      ReadHeaderValue(header, kWireBytesHashOffset) ==
+          static_cast<uint32_t>(GetWireBytesHash(wire_bytes)) &&
+      ReadHeaderValue(header, kPayloadLengthOffset) <= max_size_;
+  if (valid) {
+    payload = base::OwnedVector<uint8_t>::NewForOverwrite(
+        ReadHeaderValue(header, kPayloadLengthOffset));
+    valid = ReadFully(file, payload.begin(), payload.size()) &&
+            ReadHeaderValue(header, kChecksumOffset) ==
+                Checksum(payload.as_vector());
+  }
+  base::Fclose(file);
+  if (!valid) return {};
+  return payload;
+}
+
+void WasmDiskCache::Store(base::Vector<const uint8_t> wire_bytes,
+                          base::Vector<const uint8_t> serialized_module) {
+  size_t entry_size = kHeaderSize + serialized_module.size();
+  if (entry_size > max_size_ || serialized_module.size() > kMaxUInt32) return;
+
+  std::string file_name = EntryFileName(wire_bytes);
+  std::string temporary_path = TemporaryPath(file_name);
+  FILE* file = base::OS::FOpen(temporary_path.c_str(), "wb");
+  if (file == nullptr) return;
+
+  uint8_t header[kHeaderSize];
+  WriteHeaderValue(header, kMagicNumberOffset, kMagicNumber);
+  WriteHeaderValue(header, kVersionHashOffset, Version::Hash());
+  WriteHeaderValue(header, kWireBytesLengthOffset,
+                   static_cast<uint32_t>(wire_bytes.size()));
+  WriteHeaderValue(header, kWireBytesHashOffset,
+                   static_cast<uint32_t>(GetWireBytesHash(wire_bytes)));
+  WriteHeaderValue(header, kPayloadLengthOffset,
+                   static_cast<uint32_t>(serialized_module.size()));
+  WriteHeaderValue(header, kChecksumOffset, Checksum(serialized_module));
+  bool written =
+      fwrite(header, 1, kHeaderSize, file) == kHeaderSize &&
+      fwrite(serialized_module.begin(), 1, serialized_module.size(), file) ==
+          serialized_module.size();
+  if (base::Fclose(file) != 0) written = false;
+  if (!written) {
+    base::OS::Remove(temporary_path.c_str());
+    return;
+  }
+
+  base::MutexGuard guard(&mutex_);
+  if (!ReplaceFile(temporary_path, PathOf(file_name))) return;
+
+  std::vector<IndexEntry> index = ReadIndex();
+  std::erase_if(index, [&file_name](const IndexEntry& entry) {
+    return entry.file_name == file_name;
+  });
+  index.push_back({file_name, entry_size});
+  size_t total_size = 0;
+  for (const IndexEntry& entry : index) total_size += entry.size;
+  size_t evicted = 0;
+  while (total_size > max_size_) {
+    // The new entry itself always fits, see above.
+    DCHECK_LT(evicted, index.size() - 1);
+    base::OS::Remove(PathOf(index[evicted].file_name).c_str());
+    total_size -= index[evicted].size;
+    ++evicted;
+  }
+  index.erase(index.begin(), index.begin() + evicted);
+  WriteIndex(index);
+}
+
+std::vector<WasmDiskCache::IndexEntry> WasmDiskCache::ReadIndex() const {
+  mutex_.AssertHeld();
+  std::vector<IndexEntry> index;
+  FILE* file = base::OS::FOpen(PathOf(kIndexFileName).c_str(), "r");
+  if (file == nullptr) return index;
+  char file_name[64];
+  size_t size;
+  while (fscanf(file, "%63s %zu", file_name, &size) == 2) {
+    index.push_back({file_name, size});
+  }
+  base::Fclose(file);
+  return index;
+}
+
+void WasmDiskCache::WriteIndex(const std::vector<IndexEntry>& index) {
+  mutex_.AssertHeld();
+  std::string temporary_path = TemporaryPath(kIndexFileName);
+  FILE* file = base::OS::FOpen(temporary_path.c_str(), "w");
+  if (file == nullptr) return;
+  bool written = true;
+  for (const IndexEntry& entry : index) {
+    if (fprintf(file, "%s %zu\n", entry.file_name.c_str(), entry.size) < 0) {
+      written = false;
+    }
+  }
+  if (base::Fclose(file) != 0) written = false;
+  if (!written) {
+    base::OS::Remove(temporary_path.c_str());
+    return;
+  }
+  ReplaceFile(temporary_path, PathOf(kIndexFileName));
+}
+
+}  // namespace v8::internal::wasm
@@ -0,0 +1,99 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_WASM_WASM_DISK_CACHE_H_
+#define V8_WASM_WASM_DISK_CACHE_H_
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+
+namespace v8::internal::wasm {
+
+// A bounded cache of serialized native modules in a directory on disk, for
+// embedders (like d8) that do not implement their own code caching. Entries
+// are addressed by the hash and length of the wire bytes, and carry the V8
+// version and a checksum of the serialized module, so that stale or corrupted
+// entries are rejected on lookup. Any remaining incompatibility (e.g. of the
+// CPU features) is caught by the deserializer itself.
+//
+// The cache directory can be shared by several processes. Entries are
+// written to a temporary file first and then renamed, so readers never see
+// partial entries. The total size is bounded via an index file that lists
+// the entries in the order they were stored; the oldest entries are evicted
+// first. Concurrent updates of the index from several processes can lose
+// entries from the index, so the bound is best effort in that case.
+class V8_EXPORT_PRIVATE WasmDiskCache {
+ public:
+  WasmDiskCache(std::string directory, size_t max_size);
+
+  // Disallow copying (not needed, so most probably a bug).
+  WasmDiskCache(const WasmDiskCache&) = delete;
+  WasmDiskCache& operator=(const WasmDiskCache&) = delete;
+
+  // Returns the serialized module stored for {wire_bytes}, or an empty vector
+  // if there is none or it does not pass the integrity checks.
+  base::OwnedVector<const uint8_t> Lookup(
+      base::Vector<const uint8_t> wire_bytes);
+
+  // Stores {serialized_module} for {wire_bytes}, replacing a previous entry,
+  // and evicts the oldest entries if the cache grows beyond its maximum size.
+  void Store(base::Vector<const uint8_t> wire_bytes,
+             base::Vector<const uint8_t> serialized_module);
+
+  std::string EntryPathForTesting(
+      base::Vector<const uint8_t> wire_bytes) const {
+    return PathOf(EntryFileName(wire_bytes));
+  }
+
+  const std::string& directory() const { return directory_; }
+  size_t max_size() const { return max_size_; }
+
+  static constexpr uint32_t kMagicNumber = 0x4d435741;  // "AWCM"
+
+  // Layout of the entry header; all values are uint32_t.
+  static constexpr int kMagicNumberOffset = 0;
+  static constexpr int kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
+  static constexpr int kWireBytesLengthOffset =
+      kVersionHashOffset + kUInt32Size;
+  static constexpr int kWireBytesHashOffset =
+      kWireBytesLengthOffset + kUInt32Size;
+  static constexpr int kPayloadLengthOffset =
+      kWireBytesHashOffset + kUInt32Size;
+  static constexpr int kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static constexpr int kHeaderSize = kChecksumOffset + kUInt32Size;
+
+ private:
+  struct IndexEntry {
+    std::string file_name;
+    size_t size;
+  };
+
+  std::string EntryFileName(base::Vector<const uint8_t> wire_bytes) const;
+  std::string PathOf(const std::string& file_name) const;
+  // Returns a fresh path for writing a file that gets renamed afterwards.
+  std::string TemporaryPath(const std::string& file_name);
+
+  // Hold {mutex_} when calling these methods.
+  std::vector<IndexEntry> ReadIndex() const;
+  void WriteIndex(const std::vector<IndexEntry>& index);
+
+  const std::string directory_;
+  const size_t max_size_;
+  std::atomic<uint32_t> next_temporary_id_{0};
+  // Serializes updates of the index from within this process.
+  mutable base::Mutex mutex_;
+};
+
+}  // namespace v8::internal::wasm
+
+#endif  // V8_WASM_WASM_DISK_CACHE_H_
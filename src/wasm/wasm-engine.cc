@@ -35,6 +35,7 @@
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-pointer-table.h"
 #include "src/wasm/wasm-debug.h"
+#include "src/wasm/wasm-disk-cache.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
 
@@ -1078,6 +1079,20 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   return module_object;
 }
 
+void WasmEngine::SetDiskCache(const char* directory, size_t max_size) {
+  std::shared_ptr<WasmDiskCache> disk_cache;
+  if (directory != nullptr) {
+    disk_cache = std::make_shared<WasmDiskCache>(directory, max_size);
+  }
+  base::MutexGuard guard(&mutex_);
+  disk_cache_ = std::move(disk_cache);
+}
+
+std::shared_ptr<WasmDiskCache> WasmEngine::disk_cache() {
+  base::MutexGuard guard(&mutex_);
+  return disk_cache_;
+}
+
 std::pair<size_t, size_t> WasmEngine::FlushLiftoffCode() {
   WasmCodeRefScope ref_scope;
   base::MutexGuard guard(&mutex_);
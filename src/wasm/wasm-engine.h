@@ -50,6 +50,7 @@ class AsyncCompileJob;
 class ErrorThrower;
 struct ModuleWireBytes;
 class StreamingDecoder;
+class WasmDiskCache;
 class WasmEnabledFeatures;
 class WasmOrphanedGlobalHandle;
 
@@ -236,6 +237,13 @@ class V8_EXPORT_PRIVATE WasmEngine {
       Isolate* isolate, std::shared_ptr<NativeModule> shared_module,
       base::Vector<const char> source_url);
 
+  // Enables the on-disk cache of compiled modules in {directory}, bounded to
+  // {max_size} bytes, or disables it if {directory} is nullptr.
+  void SetDiskCache(const char* directory, size_t max_size);
+
+  // Returns the on-disk cache of compiled modules, or nullptr if disabled.
+  std::shared_ptr<WasmDiskCache> disk_cache();
+
   // Flushes all Liftoff code and returns the sizes of the removed
   // (executable) code and the removed metadata.
   std::pair<size_t, size_t> FlushLiftoffCode();
@@ -492,6 +500,8 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   NativeModuleCache native_module_cache_;
 
+  std::shared_ptr<WasmDiskCache> disk_cache_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 };
@@ -1048,6 +1048,16 @@ bool IsSupportedVersion(base::Vector<const uint8_t> header,
          0;
 }
 
+bool DeserializeNativeModuleCode(NativeModule* native_module,
+                                 base::Vector<const uint8_t> data) {
+  NativeModuleDeserializer deserializer(native_module);
+  Reader reader(data + WasmSerializer::kHeaderSize);
+  if (!deserializer.Read(&reader)) return false;
+  native_module->compilation_state()->InitializeAfterDeserialization(
+      deserializer.lazy_functions(), deserializer.eager_functions());
+  return true;
+}
+
 MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate* isolate, base::Vector<const uint8_t> data,
     base::Vector<const uint8_t> wire_bytes_vec,
@@ -1092,16 +1102,13 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     shared_native_module->compilation_state()->set_compilation_id(-2);
     shared_native_module->SetWireBytes(std::move(owned_wire_bytes));
 
-    NativeModuleDeserializer deserializer(shared_native_module.get());
-    Reader reader(data + WasmSerializer::kHeaderSize);
-    bool error = !deserializer.Read(&reader);
+    bool error =
+        !DeserializeNativeModuleCode(shared_native_module.get(), data);
     if (error) {
       wasm_engine->UpdateNativeModuleCache(
           error, std::move(shared_native_module), isolate);
       return {};
     }
-    shared_native_module->compilation_state()->InitializeAfterDeserialization(
-        deserializer.lazy_functions(), deserializer.eager_functions());
     wasm_engine->UpdateNativeModuleCache(error, shared_native_module, isolate);
     PublishDetectedFeatures(detected_features, isolate, true);
   }
@@ -57,6 +57,13 @@ class V8_EXPORT_PRIVATE WasmSerializer {
 bool IsSupportedVersion(base::Vector<const uint8_t> data,
                         WasmEnabledFeatures enabled_features);
 
+// Deserializes the code in {data} into {native_module}, which must have been
+// created for the module that {data} was serialized from. This does not touch
+// the isolate, so it can run on a background thread. Returns false if {data}
+// cannot be deserialized.
+V8_EXPORT_PRIVATE bool DeserializeNativeModuleCode(
+    NativeModule* native_module, base::Vector<const uint8_t> data);
+
 // Deserializes the given data to create a Wasm module object.
 V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate*, base::Vector<const uint8_t> data,
@@ -0,0 +1,92 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Creates contexts in a separate isolate, so that the isolate can be
+// configured per benchmark. The argument selects whether the isolate caches
+// decompressed context snapshots, which is only supported in builds with
+// snapshot compression.
+class ContextCreation : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    allocator_.reset(v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = allocator_.get();
+#ifdef V8_SNAPSHOT_COMPRESSION
+    create_params.cache_decompressed_context_snapshots = state.range(0) != 0;
+#endif  // V8_SNAPSHOT_COMPRESSION
+    isolate_ = v8::Isolate::New(create_params);
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    isolate_->Dispose();
+    isolate_ = nullptr;
+    allocator_.reset();
+  }
+
+ protected:
+  v8::Isolate* isolate() { return isolate_; }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  v8::Isolate* isolate_ = nullptr;
+};
+
+// Plain Context::New is measured in every build, with the cache only where it
+// exists.
+void CacheDecompressedContextSnapshotsArgs(
+    benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("cache_decompressed_context_snapshots")->Arg(0);
+#ifdef V8_SNAPSHOT_COMPRESSION
+  benchmark->Arg(1);
+#endif  // V8_SNAPSHOT_COMPRESSION
+}
+
+}  // namespace
+
+BENCHMARK_DEFINE_F(ContextCreation, ContextNew)(benchmark::State& st) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(isolate());
+    v8::Local<v8::Context> context = v8::Context::New(isolate());
+    benchmark::DoNotOptimize(context);
+  }
+}
+
+BENCHMARK_REGISTER_F(ContextCreation, ContextNew)
+    ->Apply(CacheDecompressedContextSnapshotsArgs);
+
+BENCHMARK_DEFINE_F(ContextCreation, ContextNewAndRun)(benchmark::State& st) {
+  v8::Isolate::Scope isolate_scope(isolate());
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(isolate());
+    v8::Local<v8::Context> context = v8::Context::New(isolate());
+    v8::Context::Scope context_scope(context);
+    v8::Local<v8::String> source =
+        v8::String::NewFromUtf8Literal(isolate(), "[1, 2, 3].map(x => x * 2)");
+    v8::Local<v8::Value> result = v8::Script::Compile(context, source)
+                                      .ToLocalChecked()
+                                      ->Run(context)
+                                      .ToLocalChecked();
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+BENCHMARK_REGISTER_F(ContextCreation, ContextNewAndRun)
+    ->Apply(CacheDecompressedContextSnapshotsArgs);
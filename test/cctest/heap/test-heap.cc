@@ -1149,6 +1149,73 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestAdaptiveBytecodeFlushing) {
+#if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+  v8_flags.turbofan = false;
+  v8_flags.always_turbofan = false;
+  i::v8_flags.optimize_for_size = false;
+#endif  // !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
+#ifdef V8_ENABLE_SPARKPLUG
+  v8_flags.always_sparkplug = false;
+#endif  // V8_ENABLE_SPARKPLUG
+  i::v8_flags.flush_bytecode = true;
+  i::v8_flags.flush_code_adaptively = true;
+  i::v8_flags.flush_code_based_on_time = false;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Heap* heap = CcTest::heap();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    IndirectHandle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    // An expensive recompile keeps the bytecode alive for longer than the
+    // default age.
+    isolate->SetCodeFlushingRecompileCost(1000);
+    {
+      v8::HandleScope new_scope(isolate);
+      CompileRun(source);
+    }
+    IndirectHandle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(IsJSFunction(*func_value));
+    IndirectHandle<JSFunction> function = Cast<JSFunction>(func_value);
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      for (int i = 0; i < 2 * v8_flags.bytecode_old_age; i++) {
+        heap::InvokeMajorGC(heap);
+      }
+    }
+    CHECK(function->shared()->is_compiled());
+    CHECK(!function->shared()->bytecode_was_flushed());
+
+    // A cheap recompile flushes everything that wasn't run since the last GC.
+    isolate->SetCodeFlushingRecompileCost(0.001);
+    {
+      DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+      heap::InvokeMajorGC(heap);
+    }
+    CHECK(!function->shared()->is_compiled());
+    CHECK(function->shared()->bytecode_was_flushed());
+
+    CompileRun("foo()");
+    CHECK(function->shared()->is_compiled());
+    CHECK(!function->shared()->bytecode_was_flushed());
+  }
+}
+
 static void TestMultiReferencedBytecodeFlushing(bool sparkplug_compile) {
 #if !defined(V8_LITE_MODE) && defined(V8_ENABLE_TURBOFAN)
   v8_flags.turbofan = false;
@@ -70,6 +70,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/setup-isolate-for-tests.h"
+#include "test/common/flag-utils.h"
 namespace v8 {
 namespace internal {
 
@@ -462,7 +463,7 @@ static void SerializeContext(base::Vector<const uint8_t>* startup_blob_out,
   v8_isolate->Dispose();
 }
 
-#ifdef SNAPSHOT_COMPRESSION
+#ifdef V8_SNAPSHOT_COMPRESSION
 UNINITIALIZED_TEST(SnapshotCompression) {
   DisableAlwaysOpt();
   base::Vector<const uint8_t> startup_blob;
@@ -483,7 +484,29 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
-#endif  // SNAPSHOT_COMPRESSION
+
+TEST(SnapshotCompressionCodecsAndChunks) {
+  std::vector<uint8_t> payload(100 * KB + 17);
+  for (size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<uint8_t>(i % 251 < 128 ? i % 7 : i);
+  }
+  base::Vector<const uint8_t> raw_data(payload.data(), payload.size());
+  SnapshotData original_snapshot_data(raw_data);
+  for (auto codec : i::SnapshotCompression::kAllCodecs) {
+    // A single chunk, chunks which divide the payload evenly and ones which
+    // don't.
+    for (uint32_t chunk_size : {static_cast<uint32_t>(1 * MB),
+                                static_cast<uint32_t>(payload.size()),
+                                static_cast<uint32_t>(KB), 4099u}) {
+      SnapshotData compressed = i::SnapshotCompression::Compress(
+          &original_snapshot_data, codec, chunk_size);
+      SnapshotData decompressed =
+          i::SnapshotCompression::Decompress(compressed.RawData());
+      CHECK_EQ(raw_data, decompressed.RawData());
+    }
+  }
+}
+#endif  // V8_SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
   DisableAlwaysOpt();
@@ -798,6 +821,134 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlob1) {
   FreeCurrentEmbeddedBlob();
 }
 
+#if V8_OS_LINUX
+// Mapping the read-only space is only supported on Linux, see
+// ReadOnlyHeapImageDeserializer::MapOrCopyRaw.
+UNINITIALIZED_TEST(CustomSnapshotDataBlobMappableReadOnlySpace) {
+  if (!V8_STATIC_ROOTS_BOOL || !base::OS::IsRemapPageSupported()) return;
+  DisableAlwaysOpt();
+  const char* source = "function f() { return 42; }";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    FlagScope<bool> mappable(&v8_flags.mappable_read_only_snapshot, true);
+    blob = CreateSnapshotDataBlob(source);
+  }
+
+  // Back the blob by a file, so that the read-only space can be mapped from
+  // it.
+  const char* temp_dir = getenv("TMPDIR");
+  std::string file_name =
+      std::string(temp_dir ? temp_dir : "/tmp") + "/mappable-snapshot-blob-" +
+      std::to_string(base::OS::GetCurrentProcessId()) + ".bin";
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::create(file_name.c_str(), blob.raw_size,
+                                         const_cast<char*>(blob.data)));
+  CHECK_NOT_NULL(file);
+  delete[] blob.data;
+  v8::StartupData mapped_blob = {static_cast<const char*>(file->memory()),
+                                 blob.raw_size};
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &mapped_blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // The snapshot creator isolate is gone, so the read-only space is
+  // deserialized again, from the file.
+  size_t mapped_bytes_before = ReadOnlyDeserializer::mapped_bytes_for_testing();
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  CHECK_GT(ReadOnlyDeserializer::mapped_bytes_for_testing(),
+           mapped_bytes_before);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    v8::Maybe<int32_t> result =
+        CompileRun("f()")->Int32Value(isolate->GetCurrentContext());
+    CHECK_EQ(42, result.FromJust());
+    CHECK(CompileRun("'abc'.length === 3")->IsTrue());
+  }
+  isolate->Dispose();
+  file.reset();
+  remove(file_name.c_str());
+  FreeCurrentEmbeddedBlob();
+}
+#endif  // V8_OS_LINUX
+
+UNINITIALIZED_TEST(CustomSnapshotDataBlobLazyContextProperties) {
+  DisableAlwaysOpt();
+  const char* source =
+      "var reflect = Reflect;"
+      "function f() { return Atomics.isLockFree(4); }";
+
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    FlagScope<const char*> lazy_properties(
+        &v8_flags.lazy_context_snapshot_properties, "Atomics,JSON,Reflect");
+    blob = CreateSnapshotDataBlob(source);
+  }
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    for (int i = 0; i < 2; i++) {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope c_scope(context);
+      DirectHandle<NativeContext> native_context =
+          v8::Utils::OpenDirectHandle(*context);
+      CHECK(IsFixedArray(native_context->lazy_snapshot_properties()));
+
+      // The first access deserializes the values of all lazy properties.
+      CHECK(CompileRun("reflect === Reflect")->IsTrue());
+      CHECK(IsUndefined(native_context->lazy_snapshot_properties()));
+      CHECK(CompileRun("f()")->IsTrue());
+      CHECK(CompileRun("JSON.stringify({a: 1}) === '{\"a\":1}'")->IsTrue());
+      CHECK(CompileRun("var d = Object.getOwnPropertyDescriptor(globalThis, "
+                       "'JSON');"
+                       "d.value === JSON && d.writable && !d.enumerable && "
+                       "d.configurable")
+                ->IsTrue());
+    }
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+UNINITIALIZED_TEST(CachedDecompressedContextSnapshots) {
+  DisableAlwaysOpt();
+  v8::Isolate::CreateParams params;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  params.cache_decompressed_context_snapshots = true;
+  v8::Isolate* isolate = v8::Isolate::New(params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    for (int i = 0; i < 3; i++) {
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope c_scope(context);
+      CHECK(CompileRun("[1, 2, 3].indexOf(2) === 1")->IsTrue());
+      // Only the first context decompresses the context snapshot.
+      CHECK_EQ(1, i_isolate->decompressed_context_snapshot_cache()->size());
+      CHECK_NOT_NULL(i_isolate->decompressed_context_snapshot_cache()->at(0));
+    }
+  }
+  isolate->Dispose();
+}
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 static void UnreachableCallback(const FunctionCallbackInfo<Value>& info) {
   UNREACHABLE();
 }
@@ -1548,6 +1699,57 @@ bool IsCompiled(const char* name) {
       ->is_compiled();
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobLazyContextPropertiesResnapshot) {
+  DisableAlwaysOpt();
+  DisableEmbeddedBlobRefcounting();
+  FlagScope<const char*> lazy_properties(
+      &v8_flags.lazy_context_snapshot_properties, "JSON,Reflect");
+  v8::StartupData blob1 = CreateSnapshotDataBlob("var reflect = Reflect;");
+
+  // Snapshot a context created from {blob1} again, without accessing any of
+  // its lazy properties first.
+  v8::StartupData blob2;
+  {
+    SnapshotCreatorParams testing_params(nullptr, &blob1);
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      DirectHandle<NativeContext> native_context =
+          v8::Utils::OpenDirectHandle(*context);
+      CHECK(IsFixedArray(native_context->lazy_snapshot_properties()));
+      creator.SetDefaultContext(context);
+    }
+    blob2 =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+  delete[] blob1.data;
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &blob2;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope c_scope(context);
+    DirectHandle<NativeContext> native_context =
+        v8::Utils::OpenDirectHandle(*context);
+    // The values were split off again, this time into {blob2}.
+    CHECK(IsFixedArray(native_context->lazy_snapshot_properties()));
+    CHECK(CompileRun("reflect === Reflect")->IsTrue());
+    CHECK(IsUndefined(native_context->lazy_snapshot_properties()));
+    CHECK(CompileRun("JSON.stringify({a: 1}) === '{\"a\":1}'")->IsTrue());
+  }
+  isolate->Dispose();
+  delete[] blob2.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(SnapshotDataBlobWithWarmup) {
   DisableAlwaysOpt();
   const char* warmup = "Math.abs(1); Math.random = 1;";
@@ -1882,6 +2084,140 @@ TEST(CodeSerializerOnePlusOneWithBlockCoverage) {
   TestCodeSerializerOnePlusOneImpl();
 }
 
+static void TestCodeSerializerTieringDecisions(
+    CachedTieringDecision expected_decision) {
+  v8_flags.profile_guided_optimization = true;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source = "1 + 1";
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+
+  ScriptDetails default_script_details;
+  ScriptCompiler::CompilationDetails compilation_details;
+  DirectHandle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kNoCompileOptions,
+          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE,
+          &compilation_details)
+          .ToHandleChecked();
+  // Pretend that the script got optimized by Turbofan.
+  orig->set_cached_tiering_decision(CachedTieringDecision::kEarlyTurbofan);
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  // Serialization must not change the decision of the live function.
+  CHECK_EQ(CachedTieringDecision::kEarlyTurbofan,
+           orig->cached_tiering_decision());
+
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+  DirectHandle<SharedFunctionInfo> copy =
+      CompileScript(isolate, copy_source, default_script_details, &cache,
+                    v8::ScriptCompiler::kConsumeCodeCache);
+  CHECK_NE(*orig, *copy);
+  CHECK_EQ(expected_decision, copy->cached_tiering_decision());
+}
+
+TEST(CodeSerializerDropsTieringDecisions) {
+  v8_flags.code_cache_keep_tiering_decisions = false;
+  TestCodeSerializerTieringDecisions(CachedTieringDecision::kEarlySparkplug);
+}
+
+TEST(CodeSerializerKeepsTieringDecisions) {
+  v8_flags.code_cache_keep_tiering_decisions = true;
+  TestCodeSerializerTieringDecisions(CachedTieringDecision::kEarlyTurbofan);
+}
+
+// Consumes a code cache for a script defining {f}, after {f} got optimized by
+// Turbofan in the producing run, and calls the new {f} once. Returns whether
+// that first call already requested (or finished) the optimization of {f}.
+static bool TiersUpOnFirstCallAfterConsumingCodeCache() {
+  v8_flags.profile_guided_optimization = true;
+  v8_flags.profile_guided_optimization_for_empty_feedback_vector = true;
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  isolate->compilation_cache()
+      ->DisableScriptAndEval();  // Disable same-isolate code cache.
+
+  v8::HandleScope scope(CcTest::isolate());
+
+  // {f} has an empty feedback vector, so that a kept decision takes effect as
+  // soon as the vector is allocated.
+  const char* source = "function f() { return 42; }";
+  Handle<String> orig_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<String> copy_source = isolate->factory()
+                                   ->NewStringFromUtf8(base::CStrVector(source))
+                                   .ToHandleChecked();
+  Handle<JSObject> global(isolate->context()->global_object(), isolate);
+
+  ScriptDetails default_script_details;
+  ScriptCompiler::CompilationDetails compilation_details;
+  Handle<SharedFunctionInfo> orig =
+      Compiler::GetSharedFunctionInfoForScript(
+          isolate, orig_source, default_script_details,
+          v8::ScriptCompiler::kNoCompileOptions,
+          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE,
+          &compilation_details)
+          .ToHandleChecked();
+  Handle<JSFunction> orig_fun =
+      Factory::JSFunctionBuilder{isolate, orig, isolate->native_context()}
+          .Build();
+  Execution::CallScript(isolate, orig_fun, global,
+                        isolate->factory()->empty_fixed_array())
+      .Check();
+  CHECK_EQ(42, CompileRun("f()")->Int32Value(context.local()).FromJust());
+  // Pretend that {f} got optimized by Turbofan.
+  Cast<JSFunction>(v8::Utils::OpenHandle(*CompileRun("f")))
+      ->shared()
+      ->set_cached_tiering_decision(CachedTieringDecision::kEarlyTurbofan);
+
+  std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+      ScriptCompiler::CreateCodeCache(ToApiHandle<UnboundScript>(orig)));
+  AlignedCachedData cache(cached_data->data, cached_data->length);
+  Handle<SharedFunctionInfo> copy =
+      CompileScript(isolate, copy_source, default_script_details, &cache,
+                    v8::ScriptCompiler::kConsumeCodeCache);
+  CHECK_NE(*orig, *copy);
+  Handle<JSFunction> copy_fun =
+      Factory::JSFunctionBuilder{isolate, copy, isolate->native_context()}
+          .Build();
+  Execution::CallScript(isolate, copy_fun, global,
+                        isolate->factory()->empty_fixed_array())
+      .Check();
+
+  DirectHandle<JSFunction> f =
+      Cast<JSFunction>(v8::Utils::OpenHandle(*CompileRun("f")));
+  CHECK_NE(orig_fun->shared()->script(), f->shared()->script());
+  CHECK_EQ(42, CompileRun("f()")->Int32Value(context.local()).FromJust());
+  CHECK(f->has_feedback_vector());
+  return f->tiering_state() != TieringState::kNone ||
+         f->HasAttachedOptimizedCode(isolate);
+}
+
+TEST(CodeSerializerDroppedTieringDecisionTiersUpLate) {
+  if (!v8_flags.turbofan || v8_flags.always_turbofan) return;
+  v8_flags.code_cache_keep_tiering_decisions = false;
+  CHECK(!TiersUpOnFirstCallAfterConsumingCodeCache());
+}
+
+TEST(CodeSerializerKeptTieringDecisionTiersUpOnFirstCall) {
+  if (!v8_flags.turbofan || v8_flags.always_turbofan) return;
+  v8_flags.code_cache_keep_tiering_decisions = true;
+  CHECK(TiersUpOnFirstCallAfterConsumingCodeCache());
+}
+
 TEST(CodeSerializerPromotedToCompilationCache) {
   LocalContext context;
   Isolate* isolate = CcTest::i_isolate();
@@ -3079,6 +3415,356 @@ TEST(CodeSerializerAfterExecute) {
   v8_flags.always_turbofan = prev_always_turbofan_value;
 }
 
+namespace {
+
+// Compiles |js_source|, which calls f but not g, creates a code cache for it,
+// then calls g and appends a delta with g's compiled data to the cache.
+std::vector<uint8_t> CreateCodeCacheWithDelta(const char* js_source,
+                                              size_t* delta_offset) {
+  std::vector<uint8_t> code_cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+        ScriptCompiler::CreateCodeCache(script));
+    CHECK_NOT_NULL(cache);
+    // There is nothing to add before g is compiled.
+    CHECK_NULL(ScriptCompiler::CreateCodeCacheDelta(script, cache.get()));
+
+    CompileRun("g()");
+    std::unique_ptr<v8::ScriptCompiler::CachedData> delta(
+        ScriptCompiler::CreateCodeCacheDelta(script, cache.get()));
+    CHECK_NOT_NULL(delta);
+    // Only g and the script are serialized into the delta.
+    CHECK_LT(delta->length, cache->length);
+
+    code_cache.insert(code_cache.end(), cache->data,
+                      cache->data + cache->length);
+    code_cache.insert(code_cache.end(), delta->data,
+                      delta->data + delta->length);
+    // Once appended, the delta is part of the cache.
+    v8::ScriptCompiler::CachedData combined(
+        code_cache.data(), static_cast<int>(code_cache.size()));
+    CHECK_NULL(ScriptCompiler::CreateCodeCacheDelta(script, &combined));
+    *delta_offset = cache->length;
+  }
+  isolate->Dispose();
+  return code_cache;
+}
+
+}  // namespace
+
+TEST(CodeSerializerDelta) {
+  // Functions compiled after the code cache was created are appended to it as
+  // a delta, which the consumer merges into the deserialized script.
+  bool prev_always_turbofan_value = v8_flags.always_turbofan;
+  v8_flags.always_turbofan = false;
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "f()";
+  size_t delta_offset;
+  std::vector<uint8_t> code_cache =
+      CreateCodeCacheWithDelta(js_source, &delta_offset);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::CachedData* cache = new v8::ScriptCompiler::CachedData(
+        code_cache.data(), static_cast<int>(code_cache.size()));
+    v8::ScriptCompiler::Source source(
+        v8_str(js_source), v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      v8::Local<v8::Function> g = v8::Local<v8::Function>::Cast(
+          context->Global()->Get(context, v8_str("g")).ToLocalChecked());
+      CHECK(Cast<JSFunction>(*v8::Utils::OpenDirectHandle(*g))
+                ->shared()
+                ->is_compiled());
+      v8::Local<v8::Value> result =
+          g->Call(context, context->Global(), 0, nullptr).ToLocalChecked();
+      CHECK(result->Equals(context, v8_str("def")).FromJust());
+    }
+  }
+  isolate2->Dispose();
+
+  // Restore the flags.
+  v8_flags.always_turbofan = prev_always_turbofan_value;
+}
+
+TEST(CodeSerializerCorruptedDelta) {
+  // A delta which fails its checks is dropped, but the base segment is still
+  // used.
+  bool prev_always_turbofan_value = v8_flags.always_turbofan;
+  v8_flags.always_turbofan = false;
+  FlagScope<bool> verify_checksum(&v8_flags.verify_snapshot_checksum, true);
+  const char* js_source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "f()";
+  size_t delta_offset;
+  std::vector<uint8_t> code_cache =
+      CreateCodeCacheWithDelta(js_source, &delta_offset);
+  // Flip the first byte of the delta's payload.
+  code_cache[delta_offset + SerializedCodeData::kHeaderSize] ^= 0xff;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::CachedData* cache = new v8::ScriptCompiler::CachedData(
+        code_cache.data(), static_cast<int>(code_cache.size()));
+    v8::ScriptCompiler::Source source(
+        v8_str(js_source), v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("f")).ToLocalChecked());
+    v8::Local<v8::Function> g = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("g")).ToLocalChecked());
+    CHECK(Cast<JSFunction>(*v8::Utils::OpenDirectHandle(*f))
+              ->shared()
+              ->is_compiled());
+    CHECK(!Cast<JSFunction>(*v8::Utils::OpenDirectHandle(*g))
+               ->shared()
+               ->is_compiled());
+    v8::Local<v8::Value> result =
+        g->Call(context, context->Global(), 0, nullptr).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("def")).FromJust());
+  }
+  isolate2->Dispose();
+
+  // Restore the flags.
+  v8_flags.always_turbofan = prev_always_turbofan_value;
+}
+
+TEST(CodeSerializerBundle) {
+  // Scripts in a bundle share the strings they have in common and are
+  // consumed individually.
+  const char* js_sources[] = {
+      "var sharedAccumulatorValue = 0;"
+      "function incrementSharedAccumulatorValue(sharedIncrementAmount) {"
+      "  return sharedAccumulatorValue += sharedIncrementAmount;"
+      "}"
+      "incrementSharedAccumulatorValue(1)",
+      "function decrementSharedAccumulatorValue(sharedIncrementAmount) {"
+      "  return sharedAccumulatorValue -= sharedIncrementAmount;"
+      "}"
+      "incrementSharedAccumulatorValue(2) + "
+      "decrementSharedAccumulatorValue(1)"};
+  constexpr int kScriptCount = arraysize(js_sources);
+  std::vector<uint8_t> bundle_data;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    std::vector<v8::Local<v8::UnboundScript>> scripts;
+    int separate_length = 0;
+    for (const char* js_source : js_sources) {
+      v8::ScriptCompiler::Source source(v8_str(js_source),
+                                        v8::ScriptOrigin(v8_str("test")));
+      scripts.push_back(
+          v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+              .ToLocalChecked());
+      std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+          ScriptCompiler::CreateCodeCache(scripts.back()));
+      separate_length += cache->length;
+    }
+
+    std::unique_ptr<v8::ScriptCompiler::CachedData> bundle(
+        ScriptCompiler::CreateCodeCacheBundle(
+            v8::MemorySpan<const v8::Local<v8::UnboundScript>>(
+                scripts.data(), scripts.size())));
+    CHECK_NOT_NULL(bundle);
+    CHECK_LT(bundle->length, separate_length);
+    bundle_data.assign(bundle->data, bundle->data + bundle->length);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::CachedData bundle_cache(
+        bundle_data.data(), static_cast<int>(bundle_data.size()));
+    std::unique_ptr<v8::ScriptCompiler::CachedData> unconsumed_cache;
+    {
+      v8::ScriptCompiler::CodeCacheBundle bundle(isolate2, &bundle_cache);
+      CHECK_EQ(kScriptCount, bundle.GetScriptCount());
+      unconsumed_cache.reset(bundle.GetCachedData(0));
+
+      // The scripts are independent of each other, so they can be consumed
+      // in any order.
+      for (int i = kScriptCount - 1; i >= 0; --i) {
+        v8::ScriptCompiler::CachedData* cache = bundle.GetCachedData(i);
+        v8::ScriptCompiler::Source source(
+            v8_str(js_sources[i]), v8::ScriptOrigin(v8_str("test")), cache);
+        {
+          DisallowCompilation no_compile_expected(i_isolate2);
+          v8::ScriptCompiler::CompileUnboundScript(
+              isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+              .ToLocalChecked();
+        }
+        CHECK(!cache->rejected);
+      }
+
+      // A script is rejected if the open pool has a different length than
+      // the one it was serialized against, even if the checksums match.
+      std::unique_ptr<v8::ScriptCompiler::CachedData> cache(
+          bundle.GetCachedData(0));
+      std::vector<uint8_t> mismatched_data(cache->data,
+                                           cache->data + cache->length);
+      Address pool_length_address =
+          reinterpret_cast<Address>(mismatched_data.data()) +
+          SerializedCodeData::kPoolLengthOffset;
+      base::WriteLittleEndianValue<uint32_t>(
+          pool_length_address,
+          base::ReadLittleEndianValue<uint32_t>(pool_length_address) + 1);
+      v8::ScriptCompiler::Source mismatched_source(
+          v8_str(js_sources[0]), v8::ScriptOrigin(v8_str("mismatched")),
+          new v8::ScriptCompiler::CachedData(
+              mismatched_data.data(),
+              static_cast<int>(mismatched_data.size())));
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate2, &mismatched_source, v8::ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+      CHECK(mismatched_source.GetCachedData()->rejected);
+    }
+
+    // Without the bundle, its scripts are rejected. A different origin
+    // bypasses the compilation cache.
+    v8::ScriptCompiler::Source source(v8_str(js_sources[0]),
+                                      v8::ScriptOrigin(v8_str("other")),
+                                      unconsumed_cache.release());
+    v8::ScriptCompiler::CompileUnboundScript(
+        isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+        .ToLocalChecked();
+    CHECK(source.GetCachedData()->rejected);
+
+    CHECK_EQ(1, CompileRun(js_sources[0])->Int32Value(context).FromJust());
+    // incrementSharedAccumulatorValue(2) + decrementSharedAccumulatorValue(1)
+    // is 3 + 2.
+    CHECK_EQ(5, CompileRun(js_sources[1])->Int32Value(context).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerChunks) {
+  // With --code-cache-chunk-size, the compiled inner functions are split off
+  // into chunks, which are deserialized after the rest of the script.
+  const char* js_source =
+      "function f() { return 'a'; }"
+      "function g() { return function h() { return 'b'; } }"
+      "function i() { return 'c'; }"
+      "f() + g()() + i() + 'def'";
+  std::unique_ptr<v8::ScriptCompiler::CachedData> unchunked_cache(
+      CompileRunAndProduceCache(js_source, CodeCacheType::kEager));
+  v8::ScriptCompiler::CachedData* cache;
+  {
+    FlagScope<unsigned> chunk_size(&v8_flags.code_cache_chunk_size, 1);
+    cache = CompileRunAndProduceCache(js_source, CodeCacheType::kEager);
+  }
+  // Every chunk has its own header.
+  CHECK_GT(cache->length, unchunked_cache->length);
+  // Deserialize the chunks on worker threads, with handles of their own.
+  FlagScope<bool> chunk_workers(&v8_flags.stress_code_cache_chunk_workers,
+                                true);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  Isolate* i_isolate2 = reinterpret_cast<Isolate*>(isolate2);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source(v8_str(js_source),
+                                      v8::ScriptOrigin(v8_str("test")), cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(i_isolate2);
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!cache->rejected);
+
+    // The functions from the chunks are compiled like the top-level one.
+    DirectHandle<SharedFunctionInfo> toplevel =
+        v8::Utils::OpenDirectHandle(*script);
+    SharedFunctionInfo::ScriptIterator iter(
+        i_isolate2, Cast<Script>(toplevel->script()));
+    int function_count = 0;
+    for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      CHECK(info->is_compiled());
+      function_count++;
+    }
+    CHECK_EQ(5, function_count);
+
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
@@ -2,8 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#if V8_OS_POSIX
+#include <stdlib.h>
+#include <unistd.h>
+#endif  // V8_OS_POSIX
+
 #include "include/libplatform/libplatform.h"
 #include "src/api/api-inl.h"
+#include "src/base/platform/platform.h"
 #include "src/base/vector.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/init/v8.h"
@@ -12,6 +18,7 @@
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
+#include "src/wasm/wasm-disk-cache.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -316,6 +323,15 @@ ZoneBuffer GetValidModuleBytes(Zone* zone) {
   return buffer;
 }
 
+bool AllFunctionsAreTurbofan(NativeModule* native_module) {
+  WasmCodeRefScope code_ref_scope;
+  std::vector<WasmCode*> all_code = native_module->SnapshotCodeTable().first;
+  return std::all_of(all_code.begin(), all_code.end(),
+                     [](const WasmCode* code) {
+                       return code && code->tier() == ExecutionTier::kTurbofan;
+                     });
+}
+
 // Create the same valid module as above and serialize it to test streaming
 // with compiled module caching.
 ZoneBuffer GetValidCompiledModuleBytes(v8::Isolate* isolate, Zone* zone,
@@ -345,14 +361,7 @@ ZoneBuffer GetValidCompiledModuleBytes(v8::Isolate* isolate, Zone* zone,
         testing::GetExportedFunction(i_isolate, instance, export_name)
             .ToHandleChecked());
   }
-  while (true) {
-    WasmCodeRefScope code_ref_scope;
-    std::vector<WasmCode*> all_code = native_module->SnapshotCodeTable().first;
-    if (std::all_of(all_code.begin(), all_code.end(), [](const WasmCode* code) {
-          return code && code->tier() == ExecutionTier::kTurbofan;
-        })) {
-      break;
-    }
+  while (!AllFunctionsAreTurbofan(native_module)) {
     for (Handle<WasmExportedFunction> exported_function : exported_functions) {
       DirectHandle<Object> return_value =
           Execution::Call(i_isolate, exported_function,
@@ -1378,6 +1387,164 @@ STREAM_TEST(TestDeserializationFails) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+#if V8_OS_POSIX
+// Enables the disk cache of the engine in a fresh directory.
+class DiskCacheScope {
+ public:
+  DiskCacheScope() {
+    char directory[] = "/tmp/wasm-disk-cache-XXXXXX";
+    CHECK_NOT_NULL(mkdtemp(directory));
+    directory_ = directory;
+    GetWasmEngine()->SetDiskCache(directory_.c_str(), 1 * MB);
+  }
+
+  ~DiskCacheScope() {
+    for (const std::string& path : paths_) base::OS::Remove(path.c_str());
+    base::OS::Remove((directory_ + "/index").c_str());
+    rmdir(directory_.c_str());
+    GetWasmEngine()->SetDiskCache(nullptr, 0);
+  }
+
+  // Returns the disk cache, and records the entry for {wire_bytes} for
+  // cleanup.
+  WasmDiskCache* cache(base::Vector<const uint8_t> wire_bytes) {
+    WasmDiskCache* cache = GetWasmEngine()->disk_cache().get();
+    paths_.push_back(cache->EntryPathForTesting(wire_bytes));
+    return cache;
+  }
+
+ private:
+  std::string directory_;
+  std::vector<std::string> paths_;
+};
+
+enum class CompileMode { kStreaming, kNonStreaming };
+
+// Compiles {wire_bytes} asynchronously and returns the compiled module, or
+// null if compilation failed.
+std::shared_ptr<NativeModule> CompileAsync(MockPlatform* platform,
+                                           v8::Isolate* isolate,
+                                           base::Vector<const uint8_t> bytes,
+                                           CompileMode mode) {
+  if (mode == CompileMode::kStreaming) {
+    StreamTester tester(isolate);
+    tester.OnBytesReceived(bytes.begin(), bytes.size());
+    tester.FinishStream();
+    tester.RunCompilerTasks();
+    if (!tester.IsPromiseFulfilled()) return nullptr;
+    return tester.shared_native_module();
+  }
+  Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  CompilationState state = CompilationState::kPending;
+  std::string error_message;
+  Handle<WasmModuleObject> module_object;
+  GetWasmEngine()->AsyncCompile(
+      i_isolate, WasmEnabledFeatures::FromIsolate(i_isolate),
+      CompileTimeImports{},
+      std::make_shared<TestResolver>(i_isolate, &state, &error_message,
+                                     &module_object),
+      ModuleWireBytes(bytes), true, "WebAssembly.compile()");
+  platform->ExecuteTasks();
+  if (state != CompilationState::kFinished) return nullptr;
+  return module_object->shared_native_module();
+}
+
+// The tests below disable the native module cache, so that modules compiled
+// before are not found there. They do so before serializing any module, since
+// serialized modules are only valid for the flags they were created with.
+
+// Test that a module that is not in the disk cache gets compiled and stored.
+void TestDiskCacheMiss(MockPlatform* platform, v8::Isolate* isolate,
+                       CompileMode mode) {
+  FlagScope<bool> no_native_module_cache(
+      &v8_flags.wasm_native_module_cache_enabled, false);
+  // Without dynamic tiering, the module is stored once baseline compilation
+  // finished.
+  FlagScope<bool> no_dynamic_tiering(&v8_flags.wasm_dynamic_tiering, false);
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer wire_bytes = GetValidModuleBytes(&zone);
+  DiskCacheScope disk_cache_scope;
+  WasmDiskCache* cache = disk_cache_scope.cache(base::VectorOf(wire_bytes));
+
+  CHECK_NOT_NULL(
+      CompileAsync(platform, isolate, base::VectorOf(wire_bytes), mode));
+  CHECK(!cache->Lookup(base::VectorOf(wire_bytes)).empty());
+}
+
+// Test that a module in the disk cache gets deserialized instead of compiled.
+void TestDiskCacheHit(MockPlatform* platform, v8::Isolate* isolate,
+                      CompileMode mode) {
+  FlagScope<bool> no_native_module_cache(
+      &v8_flags.wasm_native_module_cache_enabled, false);
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer wire_bytes = GetValidModuleBytes(&zone);
+  // The serialized module only contains TurboFan code.
+  ZoneBuffer module_bytes =
+      GetValidCompiledModuleBytes(isolate, &zone, wire_bytes);
+  DiskCacheScope disk_cache_scope;
+  disk_cache_scope.cache(base::VectorOf(wire_bytes))
+      ->Store(base::VectorOf(wire_bytes), base::VectorOf(module_bytes));
+
+  std::shared_ptr<NativeModule> native_module =
+      CompileAsync(platform, isolate, base::VectorOf(wire_bytes), mode);
+  CHECK_NOT_NULL(native_module);
+  CHECK(AllFunctionsAreTurbofan(native_module.get()));
+}
+
+// Test that a module in the disk cache that cannot be deserialized gets
+// compiled instead.
+void TestDiskCacheDeserializationFails(MockPlatform* platform,
+                                       v8::Isolate* isolate,
+                                       CompileMode mode) {
+  FlagScope<bool> no_native_module_cache(
+      &v8_flags.wasm_native_module_cache_enabled, false);
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer wire_bytes = GetValidModuleBytes(&zone);
+  ZoneBuffer module_bytes =
+      GetValidCompiledModuleBytes(isolate, &zone, wire_bytes);
+  // Keep the valid header, so that deserialization gets started, but cut off
+  // the code.
+  std::vector<uint8_t> truncated_module_bytes(
+      module_bytes.begin(), module_bytes.begin() + WasmSerializer::kHeaderSize);
+  truncated_module_bytes.push_back(0xff);
+  DiskCacheScope disk_cache_scope;
+  disk_cache_scope.cache(base::VectorOf(wire_bytes))
+      ->Store(base::VectorOf(wire_bytes),
+              base::VectorOf(truncated_module_bytes));
+
+  CHECK_NOT_NULL(
+      CompileAsync(platform, isolate, base::VectorOf(wire_bytes), mode));
+}
+
+STREAM_TEST(TestDiskCacheMiss) {
+  TestDiskCacheMiss(platform, isolate, CompileMode::kStreaming);
+}
+
+STREAM_TEST(TestDiskCacheMissWithoutStreaming) {
+  TestDiskCacheMiss(platform, isolate, CompileMode::kNonStreaming);
+}
+
+STREAM_TEST(TestDiskCacheHit) {
+  TestDiskCacheHit(platform, isolate, CompileMode::kStreaming);
+}
+
+STREAM_TEST(TestDiskCacheHitWithoutStreaming) {
+  TestDiskCacheHit(platform, isolate, CompileMode::kNonStreaming);
+}
+
+STREAM_TEST(TestDiskCacheDeserializationFails) {
+  TestDiskCacheDeserializationFails(platform, isolate, CompileMode::kStreaming);
+}
+
+STREAM_TEST(TestDiskCacheDeserializationFailsWithoutStreaming) {
+  TestDiskCacheDeserializationFails(platform, isolate,
+                                    CompileMode::kNonStreaming);
+}
+#endif  // V8_OS_POSIX
+
 // Test that a non-empty function section with a missing code section fails.
 STREAM_TEST(TestFunctionSectionWithoutCodeSection) {
   StreamTester tester(isolate);
@@ -0,0 +1,72 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function some(a) {
+  return a.some(v => v > 2);
+}
+function every(a) {
+  return a.every(v => v < 3);
+}
+function find(a) {
+  return a.find(v => v > 1);
+}
+function findIndex(a) {
+  return a.findIndex(v => v > 1);
+}
+function reduce(a) {
+  return a.reduce((acc, v, i) => acc + v * i, 10);
+}
+
+function test(f, packed, holey, doubles, empty) {
+  %PrepareFunctionForOptimization(f);
+  assertEquals(packed[1], f(packed[0]));
+  assertEquals(holey[1], f(holey[0]));
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(packed[1], f(packed[0]));
+  assertEquals(holey[1], f(holey[0]));
+  assertEquals(empty, f([]));
+  // A new elements kind deopts, and the continuation must still produce the
+  // right result.
+  assertEquals(doubles[1], f(doubles[0]));
+}
+
+test(some, [[1, 2, 3], true], [[1, , 2], false], [[1.5, 2.5, 3.5], true],
+     false);
+test(every, [[1, 2, 3], false], [[1, , 2], true], [[1.5, 2.5, 3.5], false],
+     true);
+test(find, [[1, 2, 3], 2], [[1, , 3], 3], [[1.5, 2.5], 1.5], undefined);
+test(findIndex, [[1, 2, 3], 1], [[1, , 3], 2], [[0.5, 2.5], 1], -1);
+test(reduce, [[1, 2, 3], 18], [[1, , 3], 16], [[1.5, 2.5], 12.5], 10);
+
+// find and findIndex visit holes as undefined.
+function findUndefined(a) {
+  return a.findIndex(v => v === undefined);
+}
+%PrepareFunctionForOptimization(findUndefined);
+assertEquals(1, findUndefined([1, , 3]));
+%OptimizeMaglevOnNextCall(findUndefined);
+assertEquals(1, findUndefined([1, , 3]));
+assertEquals(-1, findUndefined([1, 2, 3]));
+
+// Lazy deopt in the callback continues with the callback's result.
+let deopt = false;
+function maybeDeopt() {
+  if (deopt) %DeoptimizeFunction(lazy);
+}
+%NeverOptimizeFunction(maybeDeopt);
+function lazy(a) {
+  return a.some(v => {
+    maybeDeopt();
+    return v === 2;
+  });
+}
+%PrepareFunctionForOptimization(lazy);
+assertTrue(lazy([1, 2, 3]));
+%OptimizeMaglevOnNextCall(lazy);
+assertTrue(lazy([1, 2, 3]));
+deopt = true;
+assertTrue(lazy([1, 2, 3]));
+assertFalse(lazy([4, 5]));
@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --maglev-bounds-check-elimination
+
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) s += a[i];
+  return s;
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum([1, 2, 3]));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(0, sum([]));
+assertEquals(45, sum([0, 1, 2, 3, 4, 5, 6, 7, 8, 9]));
+assertTrue(isMaglevved(sum));
+
+// The start of the loop is not known to be non-negative, so the remaining
+// check has to deopt.
+function sumFrom(a, start) {
+  let s = 0;
+  for (let i = start; i < a.length; i++) s += a[i];
+  return s;
+}
+
+%PrepareFunctionForOptimization(sumFrom);
+assertEquals(5, sumFrom([1, 2, 3], 1));
+%OptimizeMaglevOnNextCall(sumFrom);
+assertEquals(5, sumFrom([1, 2, 3], 1));
+assertTrue(isMaglevved(sumFrom));
+assertEquals(NaN, sumFrom([1, 2, 3], -1));
+
+// The array length may change in the loop, so the comparison with the old
+// length doesn't tell anything about the new one.
+function shrinking(a) {
+  let s = 0;
+  const n = a.length;
+  for (let i = 0; i < n; i++) {
+    s += a[i];
+    if (i == 1) a.length = 2;
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(shrinking);
+assertEquals(NaN, shrinking([1, 2, 3]));
+%OptimizeMaglevOnNextCall(shrinking);
+assertEquals(NaN, shrinking([1, 2, 3]));
+
+// Counting down.
+function reverse(a) {
+  let s = '';
+  for (let i = a.length - 1; i >= 0; i--) s += a[i];
+  return s;
+}
+
+%PrepareFunctionForOptimization(reverse);
+assertEquals('cba', reverse(['a', 'b', 'c']));
+%OptimizeMaglevOnNextCall(reverse);
+assertEquals('cba', reverse(['a', 'b', 'c']));
+assertEquals('', reverse([]));
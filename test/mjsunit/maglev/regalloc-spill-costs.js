@@ -0,0 +1,31 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --maglev --maglev-regalloc-spill-costs
+
+// Keeps more values alive across nested loops than there are registers, so
+// that the register allocator has to free registers both inside and outside
+// of loops.
+function f(n, a, b, c, d, e) {
+  let v0 = a + 1, v1 = b + 2, v2 = c + 3, v3 = d + 4, v4 = e + 5;
+  let v5 = a * 2, v6 = b * 3, v7 = c * 4, v8 = d * 5, v9 = e * 6;
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    let w0 = i + v0, w1 = i + v1, w2 = i + v2, w3 = i + v3;
+    for (let j = 0; j < n; j++) {
+      sum += (w0 ^ j) + (w1 & j) + (w2 | j) + (w3 - j);
+      sum += v4 + v5;
+      sum &= 0xffffff;
+    }
+    sum += w0 + w1 + w2 + w3 + v6 + v7;
+  }
+  return sum + v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7 + v8 + v9;
+}
+
+%PrepareFunctionForOptimization(f);
+const expected1 = f(10, 1, 2, 3, 4, 5);
+const expected2 = f(7, 11, 12, 13, 14, 15);
+%OptimizeMaglevOnNextCall(f);
+assertEquals(expected1, f(10, 1, 2, 3, 4, 5));
+assertEquals(expected2, f(7, 11, 12, 13, 14, 15));
@@ -0,0 +1,80 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --allow-natives-syntax
+// Flags: --turboshaft-bounds-check-elimination
+
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i];
+  }
+  return s;
+}
+
+function mul(a, b, c) {
+  for (let i = 0; i < c.length; i++) {
+    c[i] = a[i] * b[i];
+  }
+}
+
+// The loop condition does not bound the index used for the access, the check
+// has to stay.
+function offByOne(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i + 1] | 0;
+  }
+  return s;
+}
+
+// The index starts below 0, the check has to stay.
+function negativeStart(a) {
+  let s = 0;
+  for (let i = -1; i < a.length; i++) {
+    s += a[i] | 0;
+  }
+  return s;
+}
+
+(function TestSum() {
+  const a = new Float64Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(a));
+  assertEquals(10, sum(a));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(10, sum(a));
+  assertEquals(0, sum(new Float64Array(0)));
+  assertEquals(6, sum([1, 2, 3]));
+})();
+
+(function TestMul() {
+  const a = new Float64Array([1, 2, 3]);
+  const b = new Float64Array([4, 5, 6]);
+  const c = new Float64Array(3);
+  %PrepareFunctionForOptimization(mul);
+  mul(a, b, c);
+  mul(a, b, c);
+  %OptimizeFunctionOnNextCall(mul);
+  mul(a, b, c);
+  assertEquals([4, 10, 18], Array.from(c));
+})();
+
+(function TestOffByOne() {
+  const a = new Int32Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(offByOne);
+  assertEquals(5, offByOne(a));
+  assertEquals(5, offByOne(a));
+  %OptimizeFunctionOnNextCall(offByOne);
+  assertEquals(5, offByOne(a));
+})();
+
+(function TestNegativeStart() {
+  const a = new Int32Array([1, 2, 3]);
+  %PrepareFunctionForOptimization(negativeStart);
+  assertEquals(6, negativeStart(a));
+  assertEquals(6, negativeStart(a));
+  %OptimizeFunctionOnNextCall(negativeStart);
+  assertEquals(6, negativeStart(a));
+})();
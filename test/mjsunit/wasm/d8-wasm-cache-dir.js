@@ -0,0 +1,77 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-os-system
+
+// Runs d8 twice with the same --wasm-cache-dir. The first run compiles the
+// module and stores it once a function got tiered up; the second run gets the
+// tiered-up code from the cache. This only works on Unix, where d8 supports
+// os.system().
+
+if (this.os && os.system) {
+  const TEST_DIR =
+      '/tmp/d8-wasm-cache-dir-test-' + ((Math.random() * (1 << 30)) | 0);
+
+  // Both runs need the same flags, since the serialized module depends on
+  // them. Tier up on the first call, and store the module right after.
+  const kFlags = [
+    '--allow-natives-syntax', '--wasm-lazy-compilation',
+    '--wasm-tiering-budget=1', '--wasm-caching-threshold=1',
+    '--wasm-caching-timeout-ms=0'
+  ];
+
+  // (module (func (export "f") (result i32) (i32.const 42)))
+  const kCompile = `
+      const bytes = new Uint8Array([
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,  // header
+        0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,        // types
+        0x03, 0x02, 0x01, 0x00,                          // functions
+        0x07, 0x05, 0x01, 0x01, 0x66, 0x00, 0x00,        // exports
+        0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b   // code
+      ]);
+      const instance = WebAssembly.compile(bytes).then(
+          module => new WebAssembly.Instance(module));`;
+
+  // Calls {f} until it got tiered up and the module is in the cache, which is
+  // the case once the cache's index got written.
+  function StoreScript(dir) {
+    return kCompile + `
+        instance.then(instance => {
+          print(%IsTurboFanFunction(instance.exports.f));
+          (function wait() {
+            if (instance.exports.f() != 42) throw new Error('wrong result');
+            try {
+              if (d8.file.read('${dir}/index').length > 0) return;
+            } catch (e) {
+            }
+            setTimeout(wait, 10);
+          })();
+        });`;
+  }
+
+  const kLoadScript = kCompile + `
+      instance.then(instance => {
+        print(%IsTurboFanFunction(instance.exports.f));
+        if (instance.exports.f() != 42) throw new Error('wrong result');
+      });`;
+
+  function RunD8(dir, extra_flags, script) {
+    return os.system(
+        os.d8Path,
+        ['--wasm-cache-dir=' + dir, ...kFlags, ...extra_flags, '-e', script]);
+  }
+
+  // Test both non-streaming and streaming compilation.
+  for (const extra_flags of [[], ['--wasm-test-streaming']]) {
+    const dir = TEST_DIR + '/' + extra_flags.length;
+    os.mkdirp(dir);
+    try {
+      assertEquals('false\n', RunD8(dir, extra_flags, StoreScript(dir)));
+      assertEquals('true\n', RunD8(dir, extra_flags, kLoadScript));
+    } finally {
+      os.system('rm', ['-r', dir]);
+    }
+  }
+  os.rmdir(TEST_DIR);
+}
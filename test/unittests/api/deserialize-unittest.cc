@@ -9,6 +9,7 @@
 #include "include/v8-platform.h"
 #include "include/v8-primitive.h"
 #include "include/v8-script.h"
+#include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -241,6 +242,71 @@ TEST_F(DeserializeTest, OffThreadDeserializeRejectsDifferentSource) {
   }
 }
 
+// Check that code cache deltas are deserialized off-thread along with the base
+// segment.
+TEST_F(DeserializeTest, OffThreadDeserializeDelta) {
+  const char* source_text =
+      "function f() { return 'abc'; }"
+      "function g() { return 'def'; }"
+      "f()";
+  std::vector<uint8_t> code_cache;
+
+  {
+    IsolateAndContextScope scope(this);
+
+    Local<Script> script =
+        Script::Compile(context(), NewString(source_text)).ToLocalChecked();
+    CHECK(!script->Run(context()).IsEmpty());
+
+    std::unique_ptr<ScriptCompiler::CachedData> cached_data(
+        ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    CHECK(RunGlobalFunc("g")->StrictEquals(NewString("def")));
+    std::unique_ptr<ScriptCompiler::CachedData> delta(
+        ScriptCompiler::CreateCodeCacheDelta(script->GetUnboundScript(),
+                                             cached_data.get()));
+    CHECK_NOT_NULL(delta);
+
+    code_cache.insert(code_cache.end(), cached_data->data,
+                      cached_data->data + cached_data->length);
+    code_cache.insert(code_cache.end(), delta->data,
+                      delta->data + delta->length);
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+    const int length = static_cast<int>(code_cache.size());
+
+    DeserializeThread deserialize_thread(
+        ScriptCompiler::StartConsumingCodeCache(
+            isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                           code_cache.data(), length,
+                           ScriptCompiler::CachedData::BufferNotOwned)));
+    CHECK(deserialize_thread.Start());
+    deserialize_thread.Join();
+
+    ScriptCompiler::Source source(
+        NewString(source_text),
+        new ScriptCompiler::CachedData(
+            code_cache.data(), length,
+            ScriptCompiler::CachedData::BufferNotOwned),
+        deserialize_thread.TakeTask().release());
+    Local<Script> script =
+        ScriptCompiler::Compile(context(), &source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+
+    CHECK(!source.GetCachedData()->rejected);
+    CHECK(!script->Run(context()).IsEmpty());
+    // g was compiled from the delta, so it needs no lazy compilation.
+    Local<Function> g = Local<Function>::Cast(
+        context()->Global()->Get(context(), NewString("g")).ToLocalChecked());
+    CHECK(internal::Cast<internal::JSFunction>(*Utils::OpenDirectHandle(*g))
+              ->shared()
+              ->is_compiled());
+    CHECK(RunGlobalFunc("g")->StrictEquals(NewString("def")));
+  }
+}
+
 class DeserializeStarterThread : public base::Thread {
  public:
   explicit DeserializeStarterThread(Isolate* isolate,
@@ -527,6 +527,77 @@ TEST_F(CompileHintsTest, StreamingCompileHints) {
   EXPECT_FALSE(FunctionIsCompiled("func2"));
 }
 
+TEST_F(CompileHintsTest, SerializedCompileHints) {
+  const char* url = "http://www.foo.com/foo.js";
+  v8::ScriptOrigin origin(NewString(url), 13, 0);
+
+  // Collect the hints during a warm-up run and serialize them. As above, the
+  // next run uses a different source of the same length.
+  std::unique_ptr<v8::ScriptCompiler::CachedData> serialized;
+  {
+    const char* code = "function lazy1() {} function lazy2() {}";
+    v8::ScriptCompiler::Source script_source(NewString(code), origin);
+    Local<Script> script =
+        v8::ScriptCompiler::Compile(
+            v8_context(), &script_source,
+            v8::ScriptCompiler::CompileOptions::kProduceCompileHints)
+            .ToLocalChecked();
+    EXPECT_FALSE(script->Run(v8_context()).IsEmpty());
+    v8::ScriptCompiler::Source warm_up_source(NewString("lazy1()"), origin);
+    EXPECT_FALSE(v8::ScriptCompiler::Compile(v8_context(), &warm_up_source)
+                     .ToLocalChecked()
+                     ->Run(v8_context())
+                     .IsEmpty());
+    serialized =
+        v8::ScriptCompiler::CompileHintsData::FromCollector(
+            isolate(), script->GetCompileHintsCollector())
+            ->Serialize(NewString(code));
+  }
+
+  const char* code = "function func1() {} function func2() {}";
+  std::unique_ptr<v8::ScriptCompiler::CompileHintsData> hints =
+      v8::ScriptCompiler::CompileHintsData::Deserialize(
+          serialized->data, serialized->length, NewString(code));
+  ASSERT_TRUE(hints);
+  EXPECT_EQ(std::vector<int>{14}, hints->positions());
+
+  // Truncated data and data for a different source are rejected.
+  EXPECT_FALSE(v8::ScriptCompiler::CompileHintsData::Deserialize(
+      serialized->data, serialized->length, NewString("function f() {}")));
+  EXPECT_FALSE(v8::ScriptCompiler::CompileHintsData::Deserialize(
+      serialized->data, serialized->length - 1, NewString(code)));
+  // Also when the other source has the same length.
+  EXPECT_FALSE(v8::ScriptCompiler::CompileHintsData::Deserialize(
+      serialized->data, serialized->length,
+      NewString("function func1() {} function func3() {}")));
+  // The string representation of the source doesn't matter.
+  std::vector<uint16_t> two_byte_code(code, code + strlen(code));
+  EXPECT_TRUE(v8::ScriptCompiler::CompileHintsData::Deserialize(
+      serialized->data, serialized->length,
+      v8::String::NewFromTwoByte(isolate(), two_byte_code.data(),
+                                 v8::NewStringType::kNormal,
+                                 static_cast<int>(two_byte_code.size()))
+          .ToLocalChecked()));
+  // Nor whether it is flat.
+  EXPECT_TRUE(v8::ScriptCompiler::CompileHintsData::Deserialize(
+      serialized->data, serialized->length,
+      v8::String::Concat(isolate(), NewString("function func1() {} "),
+                         NewString("function func2() {}"))));
+
+  v8::ScriptCompiler::Source script_source(
+      NewString(code), origin, v8::ScriptCompiler::CompileHintsData::Callback,
+      hints.get());
+  Local<Script> script =
+      v8::ScriptCompiler::Compile(
+          v8_context(), &script_source,
+          v8::ScriptCompiler::CompileOptions::kConsumeCompileHints)
+          .ToLocalChecked();
+  EXPECT_FALSE(script->Run(v8_context()).IsEmpty());
+
+  EXPECT_TRUE(FunctionIsCompiled("func1"));
+  EXPECT_FALSE(FunctionIsCompiled("func2"));
+}
+
 TEST_F(ScriptTest, CompileHintsMagicCommentBasic) {
   const char* url = "http://www.foo.com/foo.js";
   v8::ScriptOrigin origin(NewString(url), 13, 0);
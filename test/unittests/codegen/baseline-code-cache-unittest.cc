@@ -0,0 +1,87 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-code-cache.h"
+
+#include "include/v8-isolate.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/init/isolate-group.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace baseline {
+
+// With multiple pointer compression cages, every isolate gets its own
+// IsolateGroup, so there is nothing to share.
+#if defined(V8_ENABLE_SPARKPLUG) && \
+    !defined(V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES)
+
+class BaselineCodeCacheTest : public TestWithPlatform {
+ public:
+  BaselineCodeCacheTest()
+      : allow_natives_syntax_(&v8_flags.allow_natives_syntax, true),
+        share_code_(&v8_flags.sparkplug_share_code, true) {}
+
+ private:
+  FlagScope<bool> allow_natives_syntax_;
+  FlagScope<bool> share_code_;
+};
+
+TEST_F(BaselineCodeCacheTest, SharedBetweenIsolates) {
+  if (!v8_flags.sparkplug) GTEST_SKIP();
+  static const char* kSource = R"(
+    function f(a, b) {
+      let x = a + b;
+      for (let i = 0; i < b; i++) x += i;
+      return x;
+    }
+    %CompileBaseline(f);
+    f(3, 4);
+  )";
+
+  IsolateWrapper isolate1(kNoCounters);
+  IsolateWrapper isolate2(kNoCounters);
+  BaselineCodeCache* cache =
+      isolate1.i_isolate()->isolate_group()->baseline_code_cache();
+  ASSERT_EQ(cache,
+            isolate2.i_isolate()->isolate_group()->baseline_code_cache());
+  size_t hits = cache->hits();
+
+  EXPECT_EQ(13, RunInNewContext(isolate1.isolate(), kSource));
+  ASSERT_GT(cache->entry_count(), 0u);
+  EXPECT_EQ(hits, cache->hits());
+
+  // The second isolate builds its code from the cache entry, and the result
+  // must behave the same.
+  EXPECT_EQ(13, RunInNewContext(isolate2.isolate(), kSource));
+  EXPECT_EQ(hits + 1, cache->hits());
+}
+
+TEST_F(BaselineCodeCacheTest, DifferentSourceMisses) {
+  if (!v8_flags.sparkplug) GTEST_SKIP();
+  IsolateWrapper isolate1(kNoCounters);
+  IsolateWrapper isolate2(kNoCounters);
+  BaselineCodeCache* cache =
+      isolate1.i_isolate()->isolate_group()->baseline_code_cache();
+  size_t hits = cache->hits();
+
+  EXPECT_EQ(3, RunInNewContext(isolate1.isolate(),
+                               "function g(a) { return a + 1; }"
+                               "%CompileBaseline(g); g(2);"));
+  // Same bytecode, but different source.
+  EXPECT_EQ(3, RunInNewContext(isolate2.isolate(),
+                               "function g(b) { return b + 1; }"
+                               "%CompileBaseline(g); g(2);"));
+  EXPECT_EQ(hits, cache->hits());
+}
+
+#endif  // V8_ENABLE_SPARKPLUG && !V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,100 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/shared-script-cache.h"
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8-isolate.h"
+#include "src/execution/isolate.h"
+#include "src/flags/flags.h"
+#include "src/init/isolate-group.h"
+#include "src/init/v8.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+// With multiple pointer compression cages, every isolate gets its own
+// IsolateGroup, so there is nothing to share.
+#ifndef V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES
+
+class SharedScriptCacheTest : public TestWithPlatform {
+ public:
+  SharedScriptCacheTest()
+      : script_cache_(&v8_flags.isolate_group_script_cache, true) {}
+
+  // Runs the tasks that add the scripts compiled in {isolate} to the cache.
+  static void RunPendingTasks(v8::Isolate* isolate) {
+    v8::Isolate::Scope isolate_scope(isolate);
+    while (v8::platform::PumpMessageLoop(V8::GetCurrentPlatform(), isolate)) {
+    }
+  }
+
+ private:
+  FlagScope<bool> script_cache_;
+};
+
+TEST_F(SharedScriptCacheTest, SharedBetweenIsolates) {
+  static const char* kSource = R"(
+    function f(a, b) { return a * b; }
+    f(6, 7);
+  )";
+
+  IsolateWrapper isolate1(kNoCounters);
+  IsolateWrapper isolate2(kNoCounters);
+  SharedScriptCache* cache =
+      isolate1.i_isolate()->isolate_group()->shared_script_cache();
+  ASSERT_EQ(cache,
+            isolate2.i_isolate()->isolate_group()->shared_script_cache());
+  // Entries of earlier tests would be hits.
+  cache->Clear();
+
+  EXPECT_EQ(42, RunInNewContext(isolate1.isolate(), kSource));
+  EXPECT_EQ(0u, cache->hits());
+  // The script is serialized after the compile.
+  EXPECT_EQ(0u, cache->entry_count());
+  RunPendingTasks(isolate1.isolate());
+  ASSERT_GT(cache->entry_count(), 0u);
+
+  // The second isolate deserializes the script from the cache entry, and the
+  // result must behave the same.
+  EXPECT_EQ(42, RunInNewContext(isolate2.isolate(), kSource));
+  EXPECT_EQ(1u, cache->hits());
+  EXPECT_EQ(0u, cache->rejections());
+}
+
+TEST_F(SharedScriptCacheTest, DifferentOriginMisses) {
+  IsolateWrapper isolate1(kNoCounters);
+  IsolateWrapper isolate2(kNoCounters);
+  SharedScriptCache* cache =
+      isolate1.i_isolate()->isolate_group()->shared_script_cache();
+  // Entries of earlier tests would be hits.
+  cache->Clear();
+
+  EXPECT_EQ(3, RunInNewContext(isolate1.isolate(), "1 + 2", "a.js"));
+  RunPendingTasks(isolate1.isolate());
+  EXPECT_EQ(3, RunInNewContext(isolate2.isolate(), "1 + 2", "b.js"));
+  EXPECT_EQ(0u, cache->hits());
+}
+
+TEST_F(SharedScriptCacheTest, DifferentSourceMisses) {
+  IsolateWrapper isolate1(kNoCounters);
+  IsolateWrapper isolate2(kNoCounters);
+  SharedScriptCache* cache =
+      isolate1.i_isolate()->isolate_group()->shared_script_cache();
+  // Entries of earlier tests would be hits.
+  cache->Clear();
+
+  EXPECT_EQ(3, RunInNewContext(isolate1.isolate(), "1 + 2"));
+  RunPendingTasks(isolate1.isolate());
+  EXPECT_EQ(4, RunInNewContext(isolate2.isolate(), "1 + 3"));
+  EXPECT_EQ(0u, cache->hits());
+}
+
+#endif  // V8_COMPRESS_POINTERS_IN_MULTIPLE_CAGES
+
+}  // namespace internal
+}  // namespace v8
@@ -96,5 +96,97 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+namespace {
+
+// The queue's clock in the tests below. Only advances when a test says so.
+base::TimeTicks fake_now;
+
+base::TimeTicks FakeNow() { return fake_now; }
+
+}  // namespace
+
+class OptimizingCompileDispatcherQueueTest : public TestWithNativeContext {
+ public:
+  void SetUp() override {
+    f_ = RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+    g_ = RunJS<JSFunction>("function h() { function k() {}; return k;}; h();");
+    IsCompiledScope is_compiled_scope;
+    ASSERT_TRUE(Compiler::Compile(i_isolate(), f_, Compiler::CLEAR_EXCEPTION,
+                                  &is_compiled_scope));
+    ASSERT_TRUE(Compiler::Compile(i_isolate(), g_, Compiler::CLEAR_EXCEPTION,
+                                  &is_compiled_scope));
+    job_f_.reset(new BlockingCompilationJob(i_isolate(), f_));
+    job_g_.reset(new BlockingCompilationJob(i_isolate(), g_));
+    fake_now = base::TimeTicks::Now();
+  }
+
+  void AdvanceClock(int milliseconds) {
+    fake_now += base::TimeDelta::FromMilliseconds(milliseconds);
+  }
+
+ protected:
+  Handle<JSFunction> f_;
+  Handle<JSFunction> g_;
+  std::unique_ptr<BlockingCompilationJob> job_f_;
+  std::unique_ptr<BlockingCompilationJob> job_g_;
+  OptimizingCompileDispatcherQueue queue_{2, &FakeNow};
+};
+
+TEST_F(OptimizingCompileDispatcherQueueTest, DequeuesByPriority) {
+  queue_.Enqueue(job_f_.get(), 10);
+  queue_.Enqueue(job_g_.get(), 1000);
+  ASSERT_FALSE(queue_.IsAvailable());
+
+  EXPECT_EQ(job_g_.get(), queue_.Dequeue());
+  EXPECT_EQ(job_f_.get(), queue_.Dequeue());
+  EXPECT_EQ(nullptr, queue_.Dequeue());
+}
+
+TEST_F(OptimizingCompileDispatcherQueueTest, WaitingJobsAge) {
+  queue_.Enqueue(job_f_.get(), 10);
+  // By the time {job_g_} is queued, {job_f_} has waited long enough to make
+  // up for the difference in priority.
+  AdvanceClock(
+      (1000 - 10) / OptimizingCompileDispatcherQueue::kAgingPerMillisecond + 1);
+  queue_.Enqueue(job_g_.get(), 1000);
+
+  EXPECT_EQ(job_f_.get(), queue_.Dequeue());
+  EXPECT_EQ(job_g_.get(), queue_.Dequeue());
+}
+
+TEST_F(OptimizingCompileDispatcherQueueTest, NewJobsWinWithoutAging) {
+  queue_.Enqueue(job_f_.get(), 10);
+  AdvanceClock(1);
+  queue_.Enqueue(job_g_.get(), 1000);
+
+  EXPECT_EQ(job_g_.get(), queue_.Dequeue());
+  EXPECT_EQ(job_f_.get(), queue_.Dequeue());
+}
+
+TEST_F(OptimizingCompileDispatcherQueueTest, Prioritize) {
+  queue_.Enqueue(job_f_.get(), 1000);
+  queue_.Enqueue(job_g_.get(), 10);
+  queue_.Prioritize(g_->shared());
+
+  EXPECT_EQ(job_g_.get(), queue_.Dequeue());
+  EXPECT_EQ(job_f_.get(), queue_.Dequeue());
+}
+
+TEST_F(OptimizingCompileDispatcherQueueTest, EvictAndRemove) {
+  queue_.Enqueue(job_f_.get(), 10);
+  queue_.Enqueue(job_g_.get(), 1000);
+
+  // Only jobs with a lower priority are evicted.
+  EXPECT_EQ(nullptr, queue_.EvictLowerPriorityThan(5));
+  EXPECT_EQ(job_f_.get(), queue_.EvictLowerPriorityThan(500));
+  EXPECT_TRUE(queue_.IsAvailable());
+
+  EXPECT_TRUE(queue_.RemoveJobsFor(*f_).empty());
+  std::vector<TurbofanCompilationJob*> removed = queue_.RemoveJobsFor(*g_);
+  ASSERT_EQ(1u, removed.size());
+  EXPECT_EQ(job_g_.get(), removed[0]);
+  EXPECT_EQ(0, queue_.Length());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -3,7 +3,9 @@
 // found in the LICENSE file.
 
 #include "src/codegen/assembler-inl.h"
+#include "src/compiler/backend/register-allocator.h"
 #include "src/compiler/pipeline.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/compiler/backend/instruction-sequence-unittest.h"
 
 namespace v8 {
@@ -767,6 +769,197 @@ INSTANTIATE_TEST_SUITE_P(
     ::testing::Combine(::testing::ValuesIn(kParameterTypes),
                        ::testing::Range(0, SlotConstraintTest::kMaxVariant)));
 
+// Forces the fast mode of the allocator (see
+// --turbo-fast-register-allocation-threshold) for every function, so that the
+// general registers are allocated by the LocalRegisterAllocator. Allocate()
+// runs the RegisterAllocatorVerifier, so these tests check that the fast mode
+// still produces a valid allocation.
+class FastRegisterAllocatorTest : public RegisterAllocatorTest {
+ public:
+  FastRegisterAllocatorTest()
+      : flag_threshold_(&v8_flags.turbo_fast_register_allocation_threshold,
+                        1) {}
+
+  void AllocateInFastMode() {
+    Allocate();
+    EXPECT_TRUE(RegisterAllocationData::UseFastMode(sequence()));
+  }
+
+ private:
+  const FlagScope<int> flag_threshold_;
+};
+
+TEST_F(FastRegisterAllocatorTest, DiamondManyPhis) {
+  constexpr int kPhis = Register::kNumRegisters * 2;
+
+  StartBlock();
+  EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+  StartBlock();
+  VReg t_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    t_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(2));
+
+  StartBlock();
+  VReg f_vals[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    f_vals[i] = DefineConstant();
+  }
+  EndBlock(Jump(1));
+
+  StartBlock();
+  TestOperand merged[kPhis];
+  for (int i = 0; i < kPhis; ++i) {
+    merged[i] = Use(Phi(t_vals[i], f_vals[i]));
+  }
+  Return(EmitCall(Slot(-1), kPhis, merged));
+  EndBlock();
+
+  AllocateInFastMode();
+}
+
+TEST_F(FastRegisterAllocatorTest, ThreeWayMerge) {
+  StartBlock();
+  auto p_0 = Parameter(Reg());
+  EndBlock(Branch(Imm(), 1, 2));
+
+  StartBlock();
+  EndBlock(Branch(Imm(), 2, 3));
+
+  StartBlock();
+  auto v_0 = Define(Reg());
+  EndBlock(Jump(3));
+
+  StartBlock();
+  auto v_1 = Define(Reg());
+  EndBlock(Jump(2));
+
+  StartBlock();
+  auto v_2 = Define(Reg());
+  EndBlock(Jump(1));
+
+  StartBlock();
+  auto phi = Phi(v_0, v_1, v_2);
+  EmitOI(Reg(), Reg(phi), Reg(p_0));
+  Return(Reg(phi));
+  EndBlock();
+
+  AllocateInFastMode();
+}
+
+// Splits in loops are no longer hoisted to the loop header in fast mode.
+TEST_F(FastRegisterAllocatorTest, LoopPhisNeedTooManyRegisters) {
+  const size_t kNumRegs = 3;
+  const size_t kParams = kNumRegs + 1;
+  SetNumRegs(kNumRegs, kNumRegs);
+
+  StartBlock();
+  auto constant = DefineConstant();
+  VReg parameters[kParams];
+  for (size_t i = 0; i < arraysize(parameters); ++i) {
+    parameters[i] = DefineConstant();
+  }
+  EndBlock();
+
+  PhiInstruction* phis[kParams];
+  {
+    StartLoop(2);
+
+    StartBlock();
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      phis[i] = Phi(parameters[i], 2);
+    }
+    for (size_t i = 0; i < arraysize(parameters); ++i) {
+      auto result = EmitOI(Same(), Reg(phis[i]), Use(constant));
+      SetInput(phis[i], 1, result);
+    }
+    EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+    StartBlock();
+    EndBlock(Jump(-1));
+
+    EndLoop();
+  }
+
+  StartBlock();
+  Return(DefineConstant());
+  EndBlock();
+
+  AllocateInFastMode();
+}
+
+// Values that are live across many instructions and calls stay in their
+// spill slots, and only get registers, possibly fixed ones, where they are
+// used.
+TEST_F(FastRegisterAllocatorTest, LongLivedValuesAndFixedRegisters) {
+  constexpr int kValues = Register::kNumRegisters * 2;
+
+  StartBlock();
+  VReg values[kValues];
+  for (int i = 0; i < kValues; ++i) {
+    values[i] = Define(Reg());
+  }
+  EndBlock();
+
+  StartBlock();
+  TestOperand call_inputs[kValues];
+  for (int i = 0; i < kValues; ++i) {
+    call_inputs[i] = Slot(values[i]);
+  }
+  auto call_result = EmitCall(Slot(-1), kValues, call_inputs);
+  EndBlock(Branch(Reg(DefineConstant()), 1, 2));
+
+  StartBlock();
+  for (int i = 0; i + 1 < kValues; i += 2) {
+    EmitOI(Reg(1), Reg(values[i], 1), Reg(values[i + 1], 0));
+  }
+  EndBlock(Jump(2));
+
+  StartBlock();
+  for (int i = 0; i < kValues; ++i) {
+    EmitOI(Same(), Reg(values[i]));
+  }
+  EndBlock(Jump(1));
+
+  StartBlock();
+  Return(Reg(call_result));
+  EndBlock();
+
+  AllocateInFastMode();
+}
+
+TEST_F(RegisterAllocatorTest, FastModeIsOnlyUsedForLargeFunctions) {
+  StartBlock();
+  auto a_reg = Parameter();
+  auto b_reg = Parameter();
+  auto c_reg = EmitOI(Reg(1), Reg(a_reg, 1), Reg(b_reg, 0));
+  Return(c_reg);
+  EndBlock(Last());
+
+  Allocate();
+  EXPECT_FALSE(RegisterAllocationData::UseFastMode(sequence()));
+
+  {
+    FlagScope<int> threshold(
+        &v8_flags.turbo_fast_register_allocation_threshold,
+        sequence()->VirtualRegisterCount() + 1);
+    EXPECT_FALSE(RegisterAllocationData::UseFastMode(sequence()));
+  }
+  {
+    FlagScope<int> threshold(
+        &v8_flags.turbo_fast_register_allocation_threshold,
+        sequence()->VirtualRegisterCount());
+    EXPECT_TRUE(RegisterAllocationData::UseFastMode(sequence()));
+  }
+  {
+    FlagScope<int> threshold(
+        &v8_flags.turbo_fast_register_allocation_threshold, 0);
+    EXPECT_FALSE(RegisterAllocationData::UseFastMode(sequence()));
+  }
+}
+
 }  // namespace
 }  // namespace compiler
 }  // namespace internal
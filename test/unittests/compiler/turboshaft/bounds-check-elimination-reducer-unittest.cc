@@ -0,0 +1,88 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/bounds-check-elimination-reducer.h"
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class BoundsCheckEliminationReducerTest : public ReducerTest {
+ public:
+  BoundsCheckEliminationReducerTest()
+      : ReducerTest(),
+        flag_bounds_check_elimination_(
+            &v8_flags.turboshaft_bounds_check_elimination, true) {}
+
+ private:
+  const FlagScope<bool> flag_bounds_check_elimination_;
+};
+
+// Builds
+//
+//     for (let i = start; i < n; i++) { check(i + offset < n) }
+//
+// where the check is a DeoptimizeIfNot(Uint32LessThan(...)).
+template <typename T>
+void BuildCheckedLoop(T& Asm, int32_t start, int32_t offset) {
+  using AssemblerT = typename T::Assembler;
+  V<Word32> n = __ TruncateWordPtrToWord32(
+      __ BitcastTaggedToWordPtr(Asm.GetParameter(0)));
+
+  ScopedVar<Word32, AssemblerT> i(&Asm, start);
+  WHILE(__ Int32LessThan(i, n)) {
+    V<Word32> index = i.Get();
+    if (offset != 0) index = __ Word32Add(index, offset);
+    __ DeoptimizeIfNot(__ Uint32LessThan(index, n), Asm.BuildFrameState(),
+                       DeoptimizeReason::kOutOfBounds, FeedbackSource{});
+    i = __ Word32Add(i, 1);
+  }
+
+  __ Return(__ SmiConstant(Smi::zero()));
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, InductionVariableCheckIsRemoved) {
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { BuildCheckedLoop(Asm, /*start*/ 0, /*offset*/ 0); });
+  ASSERT_EQ(1u, test.CountOp(Opcode::kDeoptimizeIf));
+
+  test.Run<BoundsCheckEliminationReducer>();
+  EXPECT_EQ(0u, test.CountOp(Opcode::kDeoptimizeIf));
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, ShiftedIndexCheckIsKept) {
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { BuildCheckedLoop(Asm, /*start*/ 0, /*offset*/ 1); });
+
+  test.Run<BoundsCheckEliminationReducer>();
+  EXPECT_EQ(1u, test.CountOp(Opcode::kDeoptimizeIf));
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, NegativeStartCheckIsKept) {
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { BuildCheckedLoop(Asm, /*start*/ -1, /*offset*/ 0); });
+
+  test.Run<BoundsCheckEliminationReducer>();
+  EXPECT_EQ(1u, test.CountOp(Opcode::kDeoptimizeIf));
+}
+
+TEST_F(BoundsCheckEliminationReducerTest, DisabledByFlag) {
+  FlagScope<bool> no_bounds_check_elimination(
+      &v8_flags.turboshaft_bounds_check_elimination, false);
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { BuildCheckedLoop(Asm, /*start*/ 0, /*offset*/ 0); });
+
+  test.Run<BoundsCheckEliminationReducer>();
+  EXPECT_EQ(1u, test.CountOp(Opcode::kDeoptimizeIf));
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
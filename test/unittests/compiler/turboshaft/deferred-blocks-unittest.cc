@@ -0,0 +1,100 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/instruction-selection-phase.h"
+#include "src/flags/flags.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class DeferredBlocksTest : public ReducerTest {
+ public:
+  DeferredBlocksTest()
+      : flag_defer_cold_blocks_(&v8_flags.turboshaft_defer_cold_blocks,
+                                true) {}
+
+ protected:
+  static bool IsDeferred(const Block* block) {
+    return block->get_custom_data(Block::CustomDataKind::kDeferredInSchedule);
+  }
+
+ private:
+  const FlagScope<bool> flag_defer_cold_blocks_;
+};
+
+// if (c) { deopt } else { return }
+TEST_F(DeferredBlocksTest, DeoptBlockIsDeferred) {
+  Block* deopt_block = nullptr;
+  Block* return_block = nullptr;
+  auto test = CreateFromGraph(1, [&](auto& Asm) {
+    deopt_block = __ NewBlock();
+    return_block = __ NewBlock();
+    V<Word32> cond =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::zero()));
+    __ Branch(cond, deopt_block, return_block);
+
+    __ Bind(deopt_block);
+    __ Deoptimize(V<FrameState>::Cast(Asm.BuildFrameState()),
+                  DeoptimizeReason::kInsufficientTypeFeedbackForCall,
+                  FeedbackSource());
+
+    __ Bind(return_block);
+    __ Return(__ SmiConstant(Smi::zero()));
+  });
+
+  PropagateDeferred(test.graph());
+  EXPECT_TRUE(IsDeferred(deopt_block));
+  EXPECT_FALSE(IsDeferred(return_block));
+}
+
+// if (c) { x = 1 } else { x = 2 }; deopt
+// Blocks that only lead to a deopt are cold, even if they are merges.
+TEST_F(DeferredBlocksTest, ColdnessPropagatesBackwards) {
+  Block* left = nullptr;
+  Block* right = nullptr;
+  Block* merge = nullptr;
+  Block* hot = nullptr;
+  auto test = CreateFromGraph(2, [&](auto& Asm) {
+    Block* cold_path = __ NewBlock();
+    hot = __ NewBlock();
+    left = __ NewBlock();
+    right = __ NewBlock();
+    merge = __ NewBlock();
+    V<Word32> cond =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::zero()));
+    __ Branch(cond, cold_path, hot);
+
+    __ Bind(cold_path);
+    V<Word32> cond2 =
+        __ TaggedEqual(Asm.GetParameter(1), __ SmiConstant(Smi::zero()));
+    __ Branch(cond2, left, right);
+
+    __ Bind(left);
+    __ Goto(merge);
+
+    __ Bind(right);
+    __ Goto(merge);
+
+    __ Bind(merge);
+    __ Deoptimize(V<FrameState>::Cast(Asm.BuildFrameState()),
+                  DeoptimizeReason::kInsufficientTypeFeedbackForCall,
+                  FeedbackSource());
+
+    __ Bind(hot);
+    __ Return(__ SmiConstant(Smi::zero()));
+  });
+
+  PropagateDeferred(test.graph());
+  EXPECT_TRUE(IsDeferred(left));
+  EXPECT_TRUE(IsDeferred(right));
+  EXPECT_TRUE(IsDeferred(merge));
+  EXPECT_FALSE(IsDeferred(hot));
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -323,6 +323,24 @@ TEST(Bytecodes, IsJumpIfToBoolean) {
 #undef OR_IS_BYTECODE
 #undef IN_BYTECODE_LIST
 
+TEST(Bytecodes, IsJumpLookahead) {
+  CHECK(Bytecodes::IsJumpLookahead(Bytecode::kTestEqualStrict,
+                                   OperandScale::kSingle));
+  CHECK(Bytecodes::IsJumpLookahead(Bytecode::kTestLessThan,
+                                   OperandScale::kSingle));
+  CHECK(!Bytecodes::IsJumpLookahead(Bytecode::kTestLessThan,
+                                    OperandScale::kDouble));
+  CHECK(!Bytecodes::IsJumpLookahead(Bytecode::kAdd, OperandScale::kSingle));
+  // A handler can only look ahead for one kind of bytecode, and the inlined
+  // jump tests the accumulator written by the handler.
+  for (int i = 0; i < Bytecodes::kBytecodeCount; i++) {
+    Bytecode bytecode = Bytecodes::FromByte(static_cast<uint8_t>(i));
+    if (!Bytecodes::IsJumpLookahead(bytecode, OperandScale::kSingle)) continue;
+    CHECK(!Bytecodes::IsStarLookahead(bytecode, OperandScale::kSingle));
+    CHECK(Bytecodes::WritesAccumulator(bytecode));
+  }
+}
+
 TEST(OperandScale, PrefixesRequired) {
   CHECK(!Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kSingle));
   CHECK(Bytecodes::OperandScaleRequiresPrefixBytecode(OperandScale::kDouble));
@@ -1755,6 +1755,64 @@ TEST_F(InterpreterTest, InterpreterSmiComparisons) {
   }
 }
 
+// The handlers of comparisons execute a directly following JumpIfTrue or
+// JumpIfFalse inline, see InterpreterAssembler::JumpDispatchLookahead.
+TEST_F(InterpreterTest, InterpreterComparisonFollowedByJump) {
+  int inputs[] = {-42, 0, 1, 42};
+  Bytecode jumps[] = {Bytecode::kJumpIfTrue, Bytecode::kJumpIfFalse};
+
+  for (Token::Value comparison : kComparisonTypes) {
+    for (Bytecode jump : jumps) {
+      for (int lhs : inputs) {
+        for (int rhs : inputs) {
+          FeedbackVectorSpec feedback_spec(zone());
+          BytecodeArrayBuilder builder(zone(), 1, 1, &feedback_spec);
+
+          FeedbackSlot slot = feedback_spec.AddCompareICSlot();
+          Handle<i::FeedbackMetadata> metadata =
+              FeedbackMetadata::New(i_isolate(), &feedback_spec);
+
+          Register r0(0);
+          BytecodeLabel taken;
+          builder.LoadLiteral(Smi::FromInt(lhs))
+              .StoreAccumulatorInRegister(r0)
+              .LoadLiteral(Smi::FromInt(rhs))
+              .CompareOperation(comparison, r0, GetIndex(slot));
+          if (jump == Bytecode::kJumpIfTrue) {
+            builder.JumpIfTrue(ToBooleanMode::kAlreadyBoolean, &taken);
+          } else {
+            builder.JumpIfFalse(ToBooleanMode::kAlreadyBoolean, &taken);
+          }
+          builder.LoadLiteral(Smi::FromInt(1))
+              .Return()
+              .Bind(&taken)
+              .LoadLiteral(Smi::FromInt(2))
+              .Return();
+
+          Handle<BytecodeArray> bytecode_array =
+              builder.ToBytecodeArray(i_isolate());
+
+          // The jump has to directly follow the comparison for the lookahead
+          // to apply.
+          BytecodeArrayIterator iterator(bytecode_array);
+          while (!Bytecodes::IsJumpLookahead(
+              iterator.current_bytecode(), iterator.current_operand_scale())) {
+            iterator.Advance();
+          }
+          iterator.Advance();
+          CHECK_EQ(jump, iterator.current_bytecode());
+
+          bool result = CompareC(comparison, lhs, rhs);
+          bool jump_taken = jump == Bytecode::kJumpIfTrue ? result : !result;
+          DirectHandle<Object> return_value =
+              RunBytecode(bytecode_array, metadata);
+          CHECK_EQ(jump_taken ? 2 : 1, Smi::ToInt(*return_value));
+        }
+      }
+    }
+  }
+}
+
 TEST_F(InterpreterTest, InterpreterHeapNumberComparisons) {
   double inputs[] = {std::numeric_limits<double>::min(),
                      std::numeric_limits<double>::max(),
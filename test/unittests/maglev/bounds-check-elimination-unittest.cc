@@ -0,0 +1,122 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/compiler/js-heap-broker.h"
+#include "src/maglev/maglev-compilation-info.h"
+#include "src/maglev/maglev-graph-builder.h"
+#include "src/maglev/maglev-graph-processor.h"
+#include "src/maglev/maglev-graph.h"
+#include "src/maglev/maglev-ir-inl.h"
+#include "src/maglev/maglev-phi-representation-selector.h"
+#include "src/maglev/maglev-post-hoc-optimizations-processors.h"
+#include "test/common/flag-utils.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+class MaglevBoundsCheckEliminationTest : public TestWithNativeContext {
+ public:
+  MaglevBoundsCheckEliminationTest()
+      : allow_natives_syntax_(&v8_flags.allow_natives_syntax, true) {}
+
+  // Runs {source}, which has to define {f} and collect feedback for it. Then
+  // builds the Maglev graph of {f} and runs the passes up to bounds check
+  // elimination, like MaglevCompiler::Compile. Returns the number of
+  // CheckInt32Condition nodes with {condition} that are left.
+  int CountChecksAfterBoundsCheckElimination(const char* source,
+                                             AssertCondition condition) {
+    RunJS(source);
+    Handle<JSFunction> function = RunJS<JSFunction>("f");
+
+    std::unique_ptr<MaglevCompilationInfo> info = MaglevCompilationInfo::New(
+        isolate(), function, BytecodeOffset::None());
+    compiler::CurrentHeapBrokerScope current_broker(info->broker());
+    Graph* graph = Graph::New(info->zone(), false);
+    MaglevGraphBuilder graph_builder(isolate()->main_thread_local_isolate(),
+                                     info->toplevel_compilation_unit(), graph);
+    graph_builder.Build();
+    GraphProcessor<MaglevPhiRepresentationSelector> representation_selector(
+        &graph_builder);
+    representation_selector.ProcessGraph(graph);
+    if (v8_flags.maglev_bounds_check_elimination) {
+      GraphProcessor<BoundsCheckEliminationProcessor> bounds_check_elimination;
+      bounds_check_elimination.ProcessGraph(graph);
+    }
+
+    int count = 0;
+    for (BasicBlock* block : *graph) {
+      for (Node* node : block->nodes()) {
+        CheckInt32Condition* check = node->TryCast<CheckInt32Condition>();
+        if (check != nullptr && check->condition() == condition) count++;
+      }
+    }
+    return count;
+  }
+
+ private:
+  FlagScope<bool> allow_natives_syntax_;
+};
+
+namespace {
+
+const char kSum[] = R"(
+    function f(a) {
+      let s = 0;
+      for (let i = 0; i < a.length; i++) s += a[i];
+      return s;
+    }
+    %PrepareFunctionForOptimization(f);
+    f([1, 2, 3]);
+    f([1, 2, 3]);)";
+
+// The start of the loop is not known to be non-negative.
+const char kSumFrom[] = R"(
+    function f(a, start) {
+      let s = 0;
+      for (let i = start; i < a.length; i++) s += a[i];
+      return s;
+    }
+    %PrepareFunctionForOptimization(f);
+    f([1, 2, 3], 1);
+    f([1, 2, 3], 1);)";
+
+}  // namespace
+
+TEST_F(MaglevBoundsCheckEliminationTest, InductionVariableCheckIsRemoved) {
+  FlagScope<bool> bounds_check_elimination(
+      &v8_flags.maglev_bounds_check_elimination, true);
+  EXPECT_EQ(0, CountChecksAfterBoundsCheckElimination(
+                   kSum, AssertCondition::kUnsignedLessThan));
+  EXPECT_EQ(0, CountChecksAfterBoundsCheckElimination(
+                   kSum, AssertCondition::kGreaterThanEqual));
+}
+
+TEST_F(MaglevBoundsCheckEliminationTest, UnknownStartKeepsLowerBoundCheck) {
+  FlagScope<bool> bounds_check_elimination(
+      &v8_flags.maglev_bounds_check_elimination, true);
+  // The upper bound is known from the loop condition, so only the check for
+  // a negative index is left.
+  EXPECT_EQ(0, CountChecksAfterBoundsCheckElimination(
+                   kSumFrom, AssertCondition::kUnsignedLessThan));
+  EXPECT_EQ(1, CountChecksAfterBoundsCheckElimination(
+                   kSumFrom, AssertCondition::kGreaterThanEqual));
+}
+
+TEST_F(MaglevBoundsCheckEliminationTest, DisabledByFlag) {
+  FlagScope<bool> bounds_check_elimination(
+      &v8_flags.maglev_bounds_check_elimination, false);
+  EXPECT_EQ(1, CountChecksAfterBoundsCheckElimination(
+                   kSum, AssertCondition::kUnsignedLessThan));
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
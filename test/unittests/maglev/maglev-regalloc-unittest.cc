@@ -0,0 +1,74 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_ENABLE_MAGLEV
+
+#include "src/maglev/maglev-regalloc.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace maglev {
+
+namespace {
+
+double EvictionPriority(NodeIdT distance, bool needs_spill_store = false,
+                        bool is_defined_in_loop = false,
+                        bool is_next_used_in_loop = false) {
+  return StraightForwardRegisterAllocator::EvictionPriority(
+      distance, needs_spill_store, is_defined_in_loop, is_next_used_in_loop);
+}
+
+}  // namespace
+
+TEST(MaglevRegallocTest, EvictionPrefersFurthestUse) {
+  // Without any spill or reload costs, this is the same as picking the value
+  // with the furthest next use.
+  EXPECT_GT(EvictionPriority(20), EvictionPriority(10));
+  EXPECT_GT(EvictionPriority(20, true), EvictionPriority(10, true));
+  EXPECT_GT(EvictionPriority(20, true, true, true),
+            EvictionPriority(10, true, true, true));
+}
+
+TEST(MaglevRegallocTest, EvictionPrefersSpilledValues) {
+  // A value that is already spilled is evicted before one that is used a bit
+  // later but would need a spill store.
+  EXPECT_GT(EvictionPriority(10, false), EvictionPriority(15, true));
+  // ...but not before one that is used much later.
+  EXPECT_LT(EvictionPriority(10, false), EvictionPriority(30, true));
+}
+
+TEST(MaglevRegallocTest, EvictionAvoidsSpillStoresInLoop) {
+  // A spill store in the current loop is executed on every iteration.
+  EXPECT_GT(EvictionPriority(10, true, false),
+            EvictionPriority(10, true, true));
+  EXPECT_GT(EvictionPriority(10, true, false),
+            EvictionPriority(20, true, true));
+  // Where a value is defined does not matter if it doesn't need a spill store.
+  EXPECT_EQ(EvictionPriority(10, false, false),
+            EvictionPriority(10, false, true));
+}
+
+TEST(MaglevRegallocTest, EvictionAvoidsReloadsInLoop) {
+  // A value that is next used after the loop is evicted before one that has
+  // to be reloaded in the loop.
+  EXPECT_GT(EvictionPriority(10, false, false, false),
+            EvictionPriority(10, false, false, true));
+  EXPECT_GT(EvictionPriority(10, false, false, false),
+            EvictionPriority(15, false, false, true));
+}
+
+TEST(MaglevRegallocTest, EvictionOfImmediateUse) {
+  // A distance of 0 (i.e. a use by the current node) is treated like 1, so
+  // the cost still orders the candidates.
+  EXPECT_EQ(EvictionPriority(0), EvictionPriority(1));
+  EXPECT_GT(EvictionPriority(0, false), EvictionPriority(0, true));
+}
+
+}  // namespace maglev
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_ENABLE_MAGLEV
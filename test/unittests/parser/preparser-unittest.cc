@@ -8,10 +8,13 @@
 #include "src/base/vector.h"
 #include "src/codegen/compiler.h"
 #include "src/objects/objects-inl.h"
+#include "src/parsing/parallel-preparser.h"
 #include "src/parsing/parse-info.h"
 #include "src/parsing/parsing.h"
 #include "src/parsing/preparse-data-impl.h"
 #include "src/parsing/preparse-data.h"
+#include "src/parsing/scanner-character-streams.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/parser/scope-test-helper.h"
 #include "test/unittests/parser/unicode-helpers.h"
 #include "test/unittests/test-helpers.h"
@@ -1012,5 +1015,142 @@ TEST_F(PreParserTest, ProducingAndConsumingByteData) {
   }
 }
 
+TEST_F(PreParserTest, ParallelPreparseTopLevelFunctions) {
+  constexpr char kSource[] = R"(
+    function add(a, b) { return a + b; }
+    var closure = function(x) { return function() { return x; }; };
+    var re = /function\(/.test("function(") ? 1 : 0;
+    async function* gen(y) { yield y; }
+    function other() {}
+    { function nested() {} }
+  )";
+  const std::string source(kSource);
+  auto PositionOf = [&](const char* prefix) {
+    size_t pos = source.find(prefix);
+    CHECK_NE(std::string::npos, pos);
+    return static_cast<int>(pos + strlen(prefix)) - 1;
+  };
+
+  i::Isolate* isolate = i_isolate();
+  i::UnoptimizedCompileFlags flags =
+      i::UnoptimizedCompileFlags::ForTest(isolate);
+  std::unique_ptr<i::Utf16CharacterStream> stream(
+      i::ScannerStream::ForTesting(kSource));
+  i::ParallelPreparser parallel_preparser(
+      stream.get(), flags, i::LanguageMode::kSloppy,
+      isolate->ast_string_constants(), isolate->allocator(),
+      i::v8_flags.stack_size);
+  parallel_preparser.JoinForTesting();
+
+  i::Zone zone(isolate->allocator(), ZONE_NAME);
+  i::AstValueFactory ast_value_factory(&zone, isolate->ast_string_constants(),
+                                       HashSeed(isolate));
+  i::ParallelPreparser::Result result;
+
+  // A function declaration without inner functions.
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("add("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("add"), i::LanguageMode::kSloppy,
+      &zone, &result));
+  EXPECT_EQ(2, result.num_parameters);
+  EXPECT_EQ(2, result.function_length);
+  EXPECT_EQ(0, result.num_inner_infos);
+  EXPECT_EQ(nullptr, result.preparse_data);
+  EXPECT_EQ('}', source[result.end_position - 1]);
+
+  // An anonymous function expression with an inner closure.
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("function("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kAnonymousExpression,
+      ast_value_factory.empty_string(), i::LanguageMode::kSloppy, &zone,
+      &result));
+  EXPECT_EQ(1, result.num_parameters);
+  EXPECT_EQ(1, result.num_inner_infos);
+  EXPECT_NE(nullptr, result.preparse_data);
+
+  // The regexp and string literals don't hide the function after them.
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("gen("), i::FunctionKind::kAsyncGeneratorFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("gen"), i::LanguageMode::kSloppy,
+      &zone, &result));
+  EXPECT_EQ(1, result.num_parameters);
+  // A result can only be taken once.
+  EXPECT_FALSE(parallel_preparser.TakeResult(
+      PositionOf("gen("), i::FunctionKind::kAsyncGeneratorFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("gen"), i::LanguageMode::kSloppy,
+      &zone, &result));
+
+  // Results are only handed out for functions with matching properties.
+  EXPECT_FALSE(parallel_preparser.TakeResult(
+      PositionOf("other("), i::FunctionKind::kGeneratorFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("other"), i::LanguageMode::kSloppy,
+      &zone, &result));
+
+  // Functions nested in blocks aren't preparsed in parallel.
+  EXPECT_FALSE(parallel_preparser.TakeResult(
+      PositionOf("nested("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("nested"), i::LanguageMode::kSloppy,
+      &zone, &result));
+}
+
+TEST_F(PreParserTest, ParallelPreparseSkimResumesAfterYield) {
+  // The skimmer yields after every token and has to resume where it stopped,
+  // or it would miss the functions after the first few tokens.
+  i::FlagScope<bool> stress_yield(&i::v8_flags.stress_parallel_preparse_yield,
+                                  true);
+  constexpr char kSource[] = R"(
+    "use strict";
+    function first(a) { return a; }
+    var o = { p: function(b) { return `${b}`; } };
+    function last(c) { return /}/.test(c); }
+  )";
+  const std::string source(kSource);
+  auto PositionOf = [&](const char* prefix) {
+    size_t pos = source.find(prefix);
+    CHECK_NE(std::string::npos, pos);
+    return static_cast<int>(pos + strlen(prefix)) - 1;
+  };
+
+  i::Isolate* isolate = i_isolate();
+  i::UnoptimizedCompileFlags flags =
+      i::UnoptimizedCompileFlags::ForTest(isolate);
+  std::unique_ptr<i::Utf16CharacterStream> stream(
+      i::ScannerStream::ForTesting(kSource));
+  i::ParallelPreparser parallel_preparser(
+      stream.get(), flags, i::LanguageMode::kSloppy,
+      isolate->ast_string_constants(), isolate->allocator(),
+      i::v8_flags.stack_size);
+  parallel_preparser.JoinForTesting();
+
+  i::Zone zone(isolate->allocator(), ZONE_NAME);
+  i::AstValueFactory ast_value_factory(&zone, isolate->ast_string_constants(),
+                                       HashSeed(isolate));
+  i::ParallelPreparser::Result result;
+
+  // The directive prologue, the object literal, the template literal and the
+  // regexp literal are tracked across yields.
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("first("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("first"), i::LanguageMode::kStrict,
+      &zone, &result));
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("function("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kAnonymousExpression,
+      ast_value_factory.empty_string(), i::LanguageMode::kStrict, &zone,
+      &result));
+  EXPECT_TRUE(parallel_preparser.TakeResult(
+      PositionOf("last("), i::FunctionKind::kNormalFunction,
+      i::FunctionSyntaxKind::kDeclaration,
+      ast_value_factory.GetOneByteString("last"), i::LanguageMode::kStrict,
+      &zone, &result));
+  EXPECT_EQ(static_cast<int>(source.rfind('}')) + 1, result.end_position);
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -384,6 +384,34 @@ TEST_F(ScannerStreamsTest, Utf8ChunkBoundaries) {
   }
 }
 
+TEST_F(ScannerStreamsTest, Utf8SeekInAsciiChunks) {
+  // ASCII chunks are skipped without decoding them; make sure that seeking
+  // into, over and out of them still finds the right characters, also when
+  // they are mixed with non-ASCII chunks and split characters.
+  const char* chunks[] = {"abcdefgh", "ij\xc3\xa4kl", "mnop\xe2", "\x82\xac",
+                          "qrstuvwx", "yz",           ""};
+  const uint16_t expected[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
+                               'j', 0xE4, 'k', 'l', 'm', 'n', 'o', 'p',
+                               0x20AC, 'q', 'r', 's', 't', 'u', 'v', 'w',
+                               'x', 'y', 'z'};
+  const size_t kLength = arraysize(expected);
+  const size_t kSeekPositions[] = {0, 20, 3, 27, 10, 17, 25, 8, 0, 26};
+
+  ChunkSource chunk_source(chunks);
+  std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+      v8::internal::ScannerStream::For(
+          &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+  for (size_t position : kSeekPositions) {
+    stream->Seek(position);
+    for (size_t i = position; i < kLength; i++) {
+      CHECK_EQ(i, stream->pos());
+      CHECK_EQ(expected[i], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 TEST_F(ScannerStreamsTest, Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
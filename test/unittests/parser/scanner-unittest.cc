@@ -7,6 +7,7 @@
 
 #include "src/parsing/scanner.h"
 
+#include "src/ast/ast-value-factory.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
@@ -155,5 +156,45 @@ TEST_F(ScannerTest, PeekAheadAheadAwaitExpression) {
   CHECK_TOK(tokens[3], scanner->PeekAheadAhead());
 }
 
+TEST_F(ScannerTest, LongRuns) {
+  // Runs of ordinary characters that are longer than a vector register, with
+  // special characters at all kinds of offsets, so that the vectorized fast
+  // paths of the scanner have to stop in the middle of a vector.
+  const std::string identifier = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJ_$0123";
+  const std::string string_chars = "a string with 'quotes' and more text";
+  const std::string template_chars = "a template with $ signs and * stars";
+  std::string src;
+  src += "      \t\t      " + identifier + "                 \n";
+  src += "/* a comment ** with stars * and / slashes ******/";
+  src += "/* a comment\n  with a newline ** and stars */";
+  src += "// a single line comment that is longer than a vector\n";
+  src += "\"" + string_chars + "\\n\" ";
+  src += "`" + template_chars + "${x}" + template_chars + "`";
+
+  Zone zone(i_isolate()->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(&zone, i_isolate()->ast_string_constants(),
+                                    HashSeed(i_isolate()));
+  auto CurrentLiteral = [&](Scanner* scanner) {
+    const AstRawString* symbol = scanner->CurrentSymbol(&ast_value_factory);
+    return std::string(reinterpret_cast<const char*>(symbol->raw_data()),
+                       symbol->byte_length());
+  };
+
+  auto scanner = make_scanner(src.c_str());
+  CHECK_TOK(Token::kIdentifier, scanner->Next());
+  CHECK_EQ(identifier, CurrentLiteral(scanner.get()));
+  CHECK(scanner->HasLineTerminatorBeforeNext());
+  CHECK_TOK(Token::kString, scanner->Next());
+  CHECK_EQ(string_chars + "\n", CurrentLiteral(scanner.get()));
+  CHECK_TOK(Token::kTemplateSpan, scanner->Next());
+  CHECK_EQ(template_chars, CurrentLiteral(scanner.get()));
+  CHECK_TOK(Token::kIdentifier, scanner->Next());
+  CHECK_TOK(Token::kRightBrace, scanner->peek());
+  CHECK_TOK(Token::kTemplateTail, scanner->ScanTemplateContinuation());
+  CHECK_TOK(Token::kTemplateTail, scanner->Next());
+  CHECK_EQ(template_chars, CurrentLiteral(scanner.get()));
+  CHECK_TOK(Token::kEos, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
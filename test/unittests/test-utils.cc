@@ -6,6 +6,7 @@
 
 #include "include/libplatform/libplatform.h"
 #include "include/v8-isolate.h"
+#include "include/v8-script.h"
 #include "src/api/api-inl.h"
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
@@ -67,6 +68,24 @@ IsolateWrapper::~IsolateWrapper() {
   }
 }
 
+int32_t RunInNewContext(v8::Isolate* isolate, const char* source,
+                        const char* name) {
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  v8::ScriptOrigin origin(
+      v8::String::NewFromUtf8(isolate, name).ToLocalChecked());
+  v8::ScriptCompiler::Source script_source(
+      v8::String::NewFromUtf8(isolate, source).ToLocalChecked(), origin);
+  v8::Local<v8::Value> result =
+      v8::ScriptCompiler::Compile(context, &script_source)
+          .ToLocalChecked()
+          ->Run(context)
+          .ToLocalChecked();
+  return result->Int32Value(context).FromJust();
+}
+
 namespace internal {
 
 SaveFlags::SaveFlags() {
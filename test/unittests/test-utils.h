@@ -92,6 +92,12 @@ class IsolateWrapper final {
   v8::Isolate* isolate_;
 };
 
+// Compiles and runs {source} as a script named {name} in a new context of
+// {isolate}, and returns its result as an integer. Useful for tests with
+// several isolates, e.g. of caches that are shared within an IsolateGroup.
+int32_t RunInNewContext(v8::Isolate* isolate, const char* source,
+                        const char* name = "test.js");
+
 class IsolateWithContextWrapper final {
  public:
   IsolateWithContextWrapper()
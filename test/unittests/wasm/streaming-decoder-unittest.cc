@@ -88,6 +88,11 @@ class MockStreamingProcessor : public StreamingProcessor {
 
   void OnAbort() override {}
 
+  void OnFinishedBufferedStream(
+      base::OwnedVector<const uint8_t> bytes) override {
+    result_->received_bytes = std::move(bytes);
+  }
+
   bool Deserialize(base::Vector<const uint8_t> module_bytes,
                    base::Vector<const uint8_t> wire_bytes) override {
     return false;
@@ -0,0 +1,113 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/wasm/wasm-disk-cache.h"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "src/base/platform/platform.h"
+#include "src/base/platform/wrappers.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8::internal::wasm {
+
+class WasmDiskCacheTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    char directory[] = "/tmp/wasm-disk-cache-XXXXXX";
+    ASSERT_NE(nullptr, mkdtemp(directory));
+    directory_ = directory;
+  }
+
+  void TearDown() override {
+    for (const std::string& path : paths_) base::OS::Remove(path.c_str());
+    base::OS::Remove((directory_ + "/index").c_str());
+    rmdir(directory_.c_str());
+  }
+
+  std::unique_ptr<WasmDiskCache> NewCache(size_t max_size) {
+    return std::make_unique<WasmDiskCache>(directory_, max_size);
+  }
+
+  // Returns distinct wire bytes per {seed}, and records the path of their
+  // entry for cleanup.
+  base::Vector<const uint8_t> WireBytes(WasmDiskCache* cache, uint8_t seed) {
+    wire_bytes_.push_back({0, 'a', 's', 'm', 1, 0, 0, 0, seed});
+    base::Vector<const uint8_t> bytes = base::VectorOf(wire_bytes_.back());
+    paths_.push_back(cache->EntryPathForTesting(bytes));
+    return bytes;
+  }
+
+ private:
+  std::string directory_;
+  std::vector<std::string> paths_;
+  std::list<std::vector<uint8_t>> wire_bytes_;
+};
+
+TEST_F(WasmDiskCacheTest, StoreAndLookup) {
+  auto cache = NewCache(1 * MB);
+  base::Vector<const uint8_t> wire_bytes = WireBytes(cache.get(), 1);
+  base::Vector<const uint8_t> other_wire_bytes = WireBytes(cache.get(), 2);
+  std::vector<uint8_t> module(100, 42);
+
+  EXPECT_TRUE(cache->Lookup(wire_bytes).empty());
+  cache->Store(wire_bytes, base::VectorOf(module));
+  base::OwnedVector<const uint8_t> cached = cache->Lookup(wire_bytes);
+  ASSERT_EQ(module.size(), cached.size());
+  EXPECT_EQ(0, memcmp(module.data(), cached.begin(), module.size()));
+  EXPECT_TRUE(cache->Lookup(other_wire_bytes).empty());
+
+  // A second cache on the same directory (e.g. in another process) finds the
+  // entry as well.
+  EXPECT_FALSE(NewCache(1 * MB)->Lookup(wire_bytes).empty());
+}
+
+TEST_F(WasmDiskCacheTest, RejectCorruptedEntry) {
+  auto cache = NewCache(1 * MB);
+  base::Vector<const uint8_t> wire_bytes = WireBytes(cache.get(), 1);
+  std::vector<uint8_t> module(100, 42);
+  cache->Store(wire_bytes, base::VectorOf(module));
+
+  // Flip a byte of the payload.
+  FILE* file =
+      base::OS::FOpen(cache->EntryPathForTesting(wire_bytes).c_str(), "r+b");
+  ASSERT_NE(nullptr, file);
+  fseek(file, WasmDiskCache::kHeaderSize + 17, SEEK_SET);
+  fputc(43, file);
+  base::Fclose(file);
+
+  EXPECT_TRUE(cache->Lookup(wire_bytes).empty());
+}
+
+TEST_F(WasmDiskCacheTest, EvictOldestEntries) {
+  constexpr size_t kModuleSize = 100;
+  constexpr size_t kEntrySize = WasmDiskCache::kHeaderSize + kModuleSize;
+  auto cache = NewCache(2 * kEntrySize);
+  std::vector<uint8_t> module(kModuleSize, 42);
+  base::Vector<const uint8_t> wire_bytes[] = {WireBytes(cache.get(), 1),
+                                              WireBytes(cache.get(), 2),
+                                              WireBytes(cache.get(), 3)};
+
+  for (base::Vector<const uint8_t> bytes : wire_bytes) {
+    cache->Store(bytes, base::VectorOf(module));
+  }
+  EXPECT_TRUE(cache->Lookup(wire_bytes[0]).empty());
+  EXPECT_FALSE(cache->Lookup(wire_bytes[1]).empty());
+  EXPECT_FALSE(cache->Lookup(wire_bytes[2]).empty());
+
+  // Entries that do not fit at all are not stored.
+  base::Vector<const uint8_t> large_wire_bytes = WireBytes(cache.get(), 4);
+  std::vector<uint8_t> large_module(2 * kEntrySize, 42);
+  cache->Store(large_wire_bytes, base::VectorOf(large_module));
+  EXPECT_TRUE(cache->Lookup(large_wire_bytes).empty());
+  EXPECT_FALSE(cache->Lookup(wire_bytes[2]).empty());
+}
+
+}  // namespace v8::internal::wasm